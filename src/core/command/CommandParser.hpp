@@ -24,7 +24,7 @@ class CommandParser {
       if (token.empty()) continue;  // skip empty tokens just in case
       cmd.tokens.push_back(token);  // store all meaningful tokens after name
 
-      if (token[0] == '-')
+      if (token[0] == '-' && !is_digits(token.substr(1)))  // "-5" is a negative number, not a flag
         cmd.flags.insert(token);
       else
         cmd.args.push_back(token);
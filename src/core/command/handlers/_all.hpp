@@ -14,6 +14,7 @@
 #include "scheduler-stop.hpp"
 #include "screen.hpp"
 #include "script.hpp"
+#include "symbol-bench.hpp"
 #include "vmstat.hpp"
 #include "help.hpp"
 
@@ -33,6 +34,7 @@ auto get_command_handlers() -> vec<CommandHandler> {
     make_scheduler_stop(),
     make_screen(),
     make_script(),
+    make_symbol_bench(),
     make_vmstat(),
     make_help()
   };
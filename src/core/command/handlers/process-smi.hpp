@@ -26,7 +26,7 @@ auto make_process_smi() -> CommandHandler {
           
       uint total_frames = mm_data.frame_count;
       uint page_size    = mm_data.page_size;
-      uint free_frames  = mm_data.free_frames.size();
+      uint free_frames  = mm_data.free_count();
       uint used_frames  = total_frames - free_frames;
 
       uint used_bytes   = used_frames * page_size;
@@ -54,10 +54,11 @@ auto make_process_smi() -> CommandHandler {
         cout << "Running processes and memory usage:\n\n";
 
         for (auto& [pid, table] : mm_data.page_table_map) {
-          uint pages_reserved = table.entries.size(); // Total pages allocated
+          uint pages_reserved = table.size();  // Total pages declared
           uint used_bytes = pages_reserved * mm_data.page_size;
           uint used_mib = used_bytes / 1024;
-          cout << format("process{:02d} {}MiB\n", pid, used_mib);
+          auto cap = table.rss_cap == 0 ? "-"s : to_string(table.rss_cap);
+          cout << format("process{:02d} {}MiB  RSS {}/{} frames\n", pid, used_mib, table.resident, cap);
         }
       } else if (!shell.screen.is_main()) {
         auto pid = shell.screen.get_id();
@@ -77,8 +78,17 @@ auto make_process_smi() -> CommandHandler {
 
         }
 
+        if (auto it = mm_data.page_table_map.find(pid); it != mm_data.page_table_map.end()) {
+          auto& table = it->second;
+          auto cap = table.rss_cap == 0 ? "unlimited"s : format("{} frames", table.rss_cap);
+          cout << format("\nRSS: {} frames (cap: {})\n", table.resident, cap);
+        }
+
+        auto& symbols = process.data.memory;
+        cout << format("Symbol cache: {} hits, {} misses\n", symbols.cache_hits, symbols.cache_misses);
+
         cout << format("\nCurrent instruction line: {}\n", program.ip);
-        cout << format("Lines of code: {}\n\n", program.script.size());
+        cout << format("Lines of code: {}\n\n", program.size());
 
         shell.storage.remove("process-smi.pid");
       }
@@ -67,6 +67,29 @@ auto make_report_util() -> CommandHandler {
         log << line;
       }
 
+      if (auto turnaround = data.average_turnaround()) {
+        auto line = format("\nAverage turnaround: {} ms over {} finished\n", turnaround->count(), finished.size());
+        cout << line;
+        log << line;
+      }
+
+      // Deadline record of real-time processes (kept by the edf strategy)
+      auto jobs = 0u, misses = 0u;
+      auto deadline_lines = ""s;
+      for (auto& [_, proc] : data.proc_table) {
+        auto& rt = proc->data.rt;
+        if (!rt.enabled()) continue;
+        jobs += rt.jobs;
+        misses += rt.misses;
+        deadline_lines += format("  {:<10} deadline {:>4}  period {:>4}  missed {} / {} jobs\n",
+          proc->data.name, rt.window(), rt.period, rt.misses, rt.jobs);
+      }
+      if (!deadline_lines.empty()) {
+        auto line = format("\nDeadline misses: {} of {} jobs\n", misses, jobs) + deadline_lines;
+        cout << line;
+        log << line;
+      }
+
       cout << "\033[38;5;33m" << separator << "\033[0m";
       log << separator;
       log.close();
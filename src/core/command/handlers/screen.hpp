@@ -55,6 +55,51 @@ auto make_screen() -> CommandHandler {
     return false;
   };
 
+  // Reads the number following `flag` (e.g. `--rss 4096`); 0 if the flag is absent, nullopt if its value is missing
+  auto flag_arg = [](Command& command, const str& flag) -> opt<uint> {
+    if (!command.flags.contains(flag)) return 0u;
+    auto it = std::ranges::find(command.tokens, flag);
+    if (it == command.tokens.end() || ++it == command.tokens.end() || !is_digits(*it)) return nullopt;
+    return stoui(*it);
+  };
+
+  // Reads the nice value following `--nice` (-20 to 19); 0 if the flag is absent, nullopt if invalid
+  auto nice_arg = [](Command& command) -> opt<int> {
+    if (!command.flags.contains("--nice")) return 0;
+    auto it = std::ranges::find(command.tokens, "--nice"s);
+    if (it == command.tokens.end() || ++it == command.tokens.end()) return nullopt;
+
+    auto negative = it->starts_with('-');
+    auto digits = negative ? it->substr(1) : *it;
+    if (!is_digits(digits) || digits.size() > 2) return nullopt;
+
+    auto nice = negative ? -cast<int>(stoui(digits)) : cast<int>(stoui(digits));
+    if (nice < -20 || nice > 19) return nullopt;
+    return nice;
+  };
+
+  // Reads --deadline/--period and runs the EDF admission test for `cycles` of work; prints why on failure
+  auto realtime_arg = [=](Command& command, SchedulerData& data, uint64 cycles) -> opt<RealTime> {
+    auto deadline = flag_arg(command, "--deadline");
+    auto period = flag_arg(command, "--period");
+    if (!deadline || !period) {
+      cout << "[screen] --deadline and --period expect a number of ticks.\n";
+      return nullopt;
+    }
+
+    auto rt = RealTime{ .deadline = *deadline, .period = *period };
+    if (!rt.enabled())
+      return rt;
+
+    auto demand = data.realtime_demand(cycles, rt);
+    if (!data.admit_realtime(cycles, rt)) {
+      cout << format("[screen] Admission test failed: utilization {:.2f} + {:.2f} exceeds {} cores.\n",
+        data.realtime_utilization(), demand, data.cores.size());
+      return nullopt;
+    }
+    return rt;
+  };
+
   return CommandHandler()
     .set_name("screen")
     .set_desc("Creates and switches through existing screens.")
@@ -65,6 +110,12 @@ auto make_screen() -> CommandHandler {
     .add_flag("-ls")
     .add_flag("-c")
     .add_flag("-v")
+    .add_flag("--huge")
+    .add_flag("--rss")
+    .add_flag("--weight")
+    .add_flag("--nice")
+    .add_flag("--deadline")
+    .add_flag("--period")
     
     .set_validate([](Command& command, Shell& shell) -> optional<str> {
       auto has_ls = command.flags.contains("-ls");
@@ -80,7 +131,7 @@ auto make_screen() -> CommandHandler {
       return nullopt;
     })
 
-    .set_execute([&](Command& command, Shell& shell) {
+    .set_execute([=](Command& command, Shell& shell) {
       auto& screen = shell.screen;
       auto& scheduler = shell.scheduler;
 
@@ -98,7 +149,19 @@ auto make_screen() -> CommandHandler {
         auto blue = "fg33"s;
 
         cout << format("CPU Utilization: {:.2f}%\n", cpu_util);
-        cout << format("Cores used: {} / {}\n\n", busy, size);
+        cout << format("Cores used: {} / {}\n", busy, size);
+
+        // Where core time went: running, holding a job the scheduler hasn't released yet, or empty
+        auto busy_ticks = 0ull, wait_ticks = 0ull, idle_ticks = 0ull;
+        for (auto& ref : cores.get_all()) {
+          busy_ticks += ref.get().busy_ticks;
+          wait_ticks += ref.get().wait_ticks;
+          idle_ticks += ref.get().idle_ticks;
+        }
+        if (auto total = cast<double>(busy_ticks + wait_ticks + idle_ticks); total > 0)
+          cout << format("Core time: {:.1f}% running, {:.1f}% awaiting release, {:.1f}% idle\n",
+            100 * busy_ticks / total, 100 * wait_ticks / total, 100 * idle_ticks / total);
+        cout << '\n';
         cout << Text("─", line_width)[blue] << '\n';
         cout << "Running processes:\n";
 
@@ -108,11 +171,16 @@ auto make_screen() -> CommandHandler {
           cout << render_line(process, format("Core: {:<2}", core_id));
         }
 
+        if (auto report = scheduler.strategy.report(data); !report.empty())
+          cout << '\n' << report;
+
         cout << "\nFinished processes:\n";
         for (auto pid: data.finished_pids) {
           auto& process = data.get_process(pid);
           cout << render_line(process, "Finished");
         }
+        if (auto turnaround = data.average_turnaround())
+          cout << format("\nAverage turnaround: {} ms over {} finished\n", turnaround->count(), data.finished_pids.size());
         
         cout << Text("─", line_width)[blue];
         cout << '\n';
@@ -121,7 +189,7 @@ auto make_screen() -> CommandHandler {
       // === -s: Spawn and switch to new process screen
       else if (command.flags.contains("-s")) {
         if (command.args.size() < 2)
-          return void(cout << "[screen] Usage: screen -s <name> <memory>\n");
+          return void(cout << "[screen] Usage: screen -s <name> <memory> [--huge] [--rss <bytes>] [--weight <n>] [--nice <-20..19>] [--deadline <ticks>] [--period <ticks>]\n");
 
         auto& name   = command.args[0];
         auto& memstr = command.args[1];
@@ -141,8 +209,25 @@ auto make_screen() -> CommandHandler {
         if (size < min_mem || size > max_mem || (size & (size - 1)) != 0)
           return void(cout << format("[screen] Invalid memory allocation. Must be power of 2 between {} and {}.\n", min_mem, max_mem));
 
+        auto rss = flag_arg(command, "--rss");
+        if (!rss)
+          return void(cout << "[screen] --rss expects a resident-set cap in bytes.\n");
+
+        auto weight = flag_arg(command, "--weight");
+        if (!weight)
+          return void(cout << "[screen] --weight expects a number of tickets.\n");
+
+        auto nice = nice_arg(command);
+        if (!nice)
+          return void(cout << "[screen] --nice expects a value from -20 to 19.\n");
+
+        // Admission assumes the worst case: the longest script generation can produce
+        auto rt = realtime_arg(command, scheduler.data, scheduler.data.config.getu("max-ins"));
+        if (!rt)
+          return;
+
         // Generate the process
-        scheduler.generate_process(name, size);
+        scheduler.generate_process(name, size, command.flags.contains("--huge"), *rss, *weight, *nice, *rt);
         cout << format("[screen] Waiting for process creation: {}...", name);
 
         // Wait until queued
@@ -196,7 +281,7 @@ auto make_screen() -> CommandHandler {
 
       else if (command.flags.contains("-c")) {
         if (command.args.size() < 3)
-          return void(cout << "[screen] Usage: screen -c <name> <memory> \"<instruction string>\"\n");
+          return void(cout << "[screen] Usage: screen -c <name> <memory> \"<instruction string>\" [--huge] [--rss <bytes>] [--weight <n>] [--nice <-20..19>] [--deadline <ticks>] [--period <ticks>]\n");
 
         auto& name = command.args[0];
         auto size = stoui(command.args[1]);
@@ -212,6 +297,18 @@ auto make_screen() -> CommandHandler {
         if (size < min_mem || size > max_mem || (size & (size - 1)) != 0)
           return void(cout << format("[screen] Invalid memory allocation. Must be power of 2 between {} and {}.\n", min_mem, max_mem));
 
+        auto rss = flag_arg(command, "--rss");
+        if (!rss)
+          return void(cout << "[screen] --rss expects a resident-set cap in bytes.\n");
+
+        auto weight = flag_arg(command, "--weight");
+        if (!weight)
+          return void(cout << "[screen] --weight expects a number of tickets.\n");
+
+        auto nice = nice_arg(command);
+        if (!nice)
+          return void(cout << "[screen] --nice expects a value from -20 to 19.\n");
+
         // Tokenize instruction string by semicolons
         auto token_lines = vec<vec<str>>();
         auto lines = re::split(inst_str, std::regex(";"));
@@ -230,11 +327,21 @@ auto make_screen() -> CommandHandler {
         if (script.empty())
           return void(cout << "[screen] Failed to parse instruction script.\n");
 
+        auto rt = realtime_arg(command, scheduler.data, script.size());
+        if (!rt)
+          return;
+
         // Create process and memory view
         // Generate the PID first
         auto pid = scheduler.data.new_pid();
-        auto view = scheduler.data.memory.create_memory_view_for(pid, size); // pid = 0 (will be set)
+        auto huge = command.flags.contains("--huge");
+        auto view = scheduler.data.memory.create_memory_view_for(pid, size, huge);
+        if (*rss > 0)
+          scheduler.data.memory.set_rss_cap(pid, *rss);
         auto process = Process(pid, name, move(view), move(script));
+        process.data.weight = *weight > 0 ? *weight : max(1u, scheduler.data.config.getu("default-weight"));
+        process.data.nice = *nice;
+        process.data.rt = *rt;
         scheduler.data.add_process(move(process));
         scheduler.data.rqueue.push(pid);
 
@@ -10,6 +10,11 @@ auto make_vmstat() -> CommandHandler {
     .set_desc("Provides a detailed view of the active/inactive processes, available/used memory, and pages.")
     .set_min_args(0)
     .set_max_args(0)
+    .add_flag("-heat")
+    .add_flag("-json")
+    .add_flag("-numa")
+    .add_flag("-tiers")
+    .add_flag("-store")
     
     .set_validate([](Command& command, Shell& shell) -> optional<str> {
       if (!shell.screen.is_main())
@@ -21,18 +26,84 @@ auto make_vmstat() -> CommandHandler {
     .set_execute([](Command& command, Shell& shell) {
       auto& scheduler = shell.scheduler;
       auto& memory    = scheduler.data.memory;
-      auto& ticks = scheduler.ticks;
+      auto& ticks = scheduler.data.ticks;
       auto& mm_data   = memory.data;
 
+      // === -heat: Hot/cold pages per process and frame utilization histogram
+      if (command.flags.contains("-heat"))
+        return void(cout << memory.render_heatmap());
+
+      // === -tiers: Fast/slow tier occupancy, hit rates and migration bandwidth
+      if (command.flags.contains("-tiers"))
+        return void(cout << memory.render_tiers(ticks));
+
+      // === -store: Dump the backing store to csopesy-backing-store.txt (reads back every stored page)
+      if (command.flags.contains("-store")) {
+        memory.data.store.snapshot();
+        cout << format("Wrote {} stored pages to csopesy-backing-store.txt\n", memory.data.store.size());
+        return;
+      }
+
+      // === -numa: Per-node frame pools and per-process local/remote access ratios
+      if (command.flags.contains("-numa")) {
+        auto& proc_table = scheduler.data.proc_table;
+        auto pids = vec<uint>();
+        for (auto& [pid, _] : proc_table)
+          pids.push_back(pid);
+        std::ranges::sort(pids);
+
+        cout << memory.render_numa();
+        cout << "\n[NUMA Access]\n";
+        for (auto pid : pids) {
+          auto& process = *proc_table.at(pid);
+          auto& view = process.data.memory.virtual_memory;
+          auto total = view.numa_local + view.numa_remote;
+          auto local_pct = total == 0 ? "-"s : format("{:.1f}", 100.0 * view.numa_local / total);
+          cout << format("  pid={:<3} {:<10} node={:<2} local={:<7} remote={:<7} local%={}\n", pid,
+            process.data.name, scheduler.data.node_of_core(process.data.core_id), view.numa_local, view.numa_remote, local_pct);
+        }
+        return;
+      }
+
       auto total_mem = memory.get_total_memory();
       auto free_mem  = memory.get_free_memory();
       auto used_mem  = memory.get_used_memory();
+      auto& stats    = mm_data.stats;
+
+      // === -json: One machine-readable object for monitoring scripts
+      if (command.flags.contains("-json")) {
+        cout << stats.render_json({
+          { "total_memory", total_mem },
+          { "used_memory",  used_mem },
+          { "free_memory",  free_mem },
+          { "ticks",        ticks },
+        }) << '\n';
+        return;
+      }
 
       cout << format("Total memory     : {:>8} bytes\n", total_mem);
       cout << format("Used memory      : {:>8} bytes\n", used_mem);
       cout << format("Free memory      : {:>8} bytes\n", free_mem);
       cout << format("CPU total ticks  : {:>8}\n", ticks);
-      cout << format("Pages paged in   : {:>8}\n", mm_data.num_paged_in);
-      // cout << format("Pages paged out  : {:>8}\n", paged_out);
+      cout << format("Pages paged in   : {:>8}\n", stats.get("paged_in"));
+      cout << format("Pages paged out  : {:>8}\n", stats.get("paged_out"));
+      // Host memory taken by process code: encoded scripts plus decoded regions of running code
+      auto code_encoded = 0ull, code_resident = 0ull, code_full = 0ull;
+      for (auto& [_, process] : scheduler.data.proc_table) {
+        auto& code = process->data.program.code;
+        code_encoded  += code.encoded_bytes();
+        code_resident += code.resident_bytes();
+        code_full     += code.decoded_bytes();
+      }
+      cout << format("Code host bytes  : {:>8} (encoded {} + decoded {}; {} saved vs full scripts)\n",
+        code_encoded + code_resident, code_encoded, code_resident,
+        cast<int64_t>(code_full) - cast<int64_t>(code_encoded + code_resident));
+
+      if (auto free = mm_data.free_count(); free > 0)
+        cout << format("Free contiguity  : {:>7.1f}% (largest run {} of {} free frames)\n",
+          100.0 * memory.largest_free_run() / free, memory.largest_free_run(), free);
+      if (auto dispatches = stats.get("dispatches"); dispatches > 0)
+        cout << format("Faults/dispatch  : {:>8.2f}\n", cast<double>(stats.get("faults")) / dispatches);
+      cout << stats.render();
     });
 }
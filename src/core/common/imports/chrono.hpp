@@ -9,12 +9,14 @@ using std::chrono::duration_cast;
 // Aliases for duration types
 using ms  = std::chrono::milliseconds;
 using ns  = std::chrono::nanoseconds;
+using us  = std::chrono::microseconds;
 using sec = std::chrono::seconds;
 
 // Clock and time point
 using duration = std::chrono::system_clock::duration;
 using Clock = std::chrono::system_clock;
 using Time = std::chrono::time_point<std::chrono::system_clock>;
+using SteadyClock = std::chrono::steady_clock;  // Monotonic clock for measuring latencies
 using TimeStruct = std::tm;
 
 // Literal suffixes for values like 10ms, 1s, 250ns
@@ -1,4 +1,5 @@
 #pragma once
+#include <array>
 #include <deque>
 #include <list>
 #include <map>
@@ -9,6 +10,7 @@
 #include <utility>
 #include <vector>
 
+using std::array;
 using std::deque;
 using std::list;
 using std::make_pair;
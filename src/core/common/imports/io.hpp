@@ -1,4 +1,5 @@
 #pragma once
+#include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <stdexcept>
@@ -19,6 +20,9 @@ using std::ofstream;
 using std::ostream;
 using std::runtime_error;
 
+// Filesystem namespace alias
+namespace fs = std::filesystem;
+
 
 /** @brief Reads all lines from a text file into a vector of strings. */
 auto read_lines(const std::string& path) -> std::vector<std::string> {
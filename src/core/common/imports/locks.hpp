@@ -1,5 +1,6 @@
 #pragma once
 #include <mutex>
+#include <condition_variable>
 
 
 /**
@@ -10,6 +11,14 @@
  */
 inline std::mutex mtx;
 
+/**
+ * @brief Wakes the system thread before its next tick is due.
+ *
+ * Signalled (with `mtx` held) by cores whose job is ready to be released,
+ * so the scheduler can refill them without waiting for the tick.
+ */
+inline std::condition_variable events;
+
 /**
  * @brief Executes a function with exclusive access to scheduler state.
  * 
@@ -1,6 +1,7 @@
 #pragma once
 #include <algorithm>  // required for all_of / any_of to work for some reason??
 #include <any>
+#include <bit>
 #include <cctype>
 #include <cstdint>
 #include <exception>
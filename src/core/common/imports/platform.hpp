@@ -6,6 +6,7 @@
 
 using std::min;
 using std::max;
+using std::clamp;
 using std::string;
 
 #if defined(_WIN32)
@@ -14,6 +14,7 @@ using std::atomic_uint;
 using std::atomic_bool;
 
 // === Locking & Threading Aliases ===
+using std::condition_variable;
 using std::lock_guard;
 using std::mutex;
 using std::shared_lock;
@@ -17,9 +17,11 @@
  * - Ignores ticking if no process is assigned (`job == nullptr`) or if marked `can_release`.
  * - Calls a user-provided preemption handler, if any, to check for early release.
  * - Tracks how long a job has been running via `job_ticks`.
+ * - Holds a local `runqueue` of ready pids for strategies that keep per-core queues.
  * 
  * Design Notes:
  * - Core runs **faster** than the scheduler (1ms tick vs. ~100ms scheduler tick).
+ * - Signals `events` once its job can be released, so the scheduler can refill it between ticks.
  * - Implements `assign()` and `release()` methods, but only for use by the scheduler.
  * - Internally manages its own thread and guarantees safe shutdown in destructor.
  * - Tick behavior is guarded to avoid dereferencing null process pointers.
@@ -37,6 +39,10 @@ class Core {
     can_release (false),              // Whether the process is eligible for release by the Scheduler
     job         (nullptr),            // Pointer to the currently assigned process (if any)
     preempt     (nullptr),            // For injecting a preemption handler (optional).
+    runqueue    (deque<uint>()),      // Local ready queue (per-core strategies such as ws)
+    busy_ticks  (0ull),               // Ticks spent running a job
+    wait_ticks  (0ull),               // Ticks spent holding a finished/preempted job until the scheduler releases it
+    idle_ticks  (0ull),               // Ticks spent with no job
     active      (atomic_bool{true}),  // Atomic flag for tick loop, mark the core as active/busy
     thread      ()                    // Background ticking thread
   { 
@@ -86,6 +92,10 @@ class Core {
   bool can_release;   
   Process* job; 
   func preempt;    
+  deque<uint> runqueue;
+  uint64 busy_ticks;
+  uint64 wait_ticks;
+  uint64 idle_ticks;
   atomic_bool active;   
   Thread thread; 
 
@@ -95,13 +105,14 @@ class Core {
 
   /** @brief Performs one CPU tick: steps the assigned process if valid. */
   void tick() {
-    if (job == nullptr) return; // If no process is assigned to this core, skip the tick
-    if (can_release) return;    // Prevent ticking the process if it's already marked for release
+    if (job == nullptr) return void(++idle_ticks); // If no process is assigned to this core, skip the tick
+    if (can_release) return void(++wait_ticks);    // Prevent ticking the process if it's already marked for release
 
     try {
       auto& process = *job;       // Get the process from the process pointer
       process.step();             // Execute one instruction from the process script
       ++job_ticks;
+      ++busy_ticks;
 
       // If the process has finished all its instructions, mark for release
       if (process.data.program.finished())
@@ -115,6 +126,10 @@ class Core {
       else if (preempt && preempt(*this))
         can_release = true;
 
+      // Let the scheduler hand this core new work now rather than at its next tick
+      if (can_release)
+        events.notify_one();
+
     } catch (exception& e) {
       cerr << format("[Core {}] tick(): Exception: {}\n", id, e.what());
       throw;
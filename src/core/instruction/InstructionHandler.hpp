@@ -42,9 +42,12 @@ class InstructionHandler {
   /** @brief Generates a random instruction based on the signature. */
   auto generate() -> Instruction {
     auto inst = Instruction(opcode);
-    if (signatures.empty()) return inst;
+    auto candidates = vec<ref<Signature>>();
+    for (auto& sig : signatures)
+      if (sig.is_generatable()) candidates.push_back(ref(sig));
+    if (candidates.empty()) return inst;
 
-    auto& sig = Rand::pick(signatures);
+    auto& sig = Rand::pick(candidates).get();
     inst.args = sig.generate();
     return inst;
   }
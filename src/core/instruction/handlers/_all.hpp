@@ -4,6 +4,9 @@
 #include "declare.hpp"
 #include "endfor.hpp"
 #include "for.hpp"
+#include "memcmp.hpp"
+#include "memcpy.hpp"
+#include "memset.hpp"
 #include "print.hpp"
 #include "sleep.hpp"
 #include "subtract.hpp"
@@ -15,6 +18,9 @@ auto get_instruction_handlers() -> vec<InstructionHandler> {
     make_declare(),
     make_endfor(),
     make_for(),
+    make_memcmp(),
+    make_memcpy(),
+    make_memset(),
     make_print(),
     make_sleep(),
     make_subtract(),
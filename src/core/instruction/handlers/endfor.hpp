@@ -14,15 +14,13 @@ auto make_endfor() -> InstructionHandler {
       auto& program = process.program;
       auto& context = program.context;
       auto& frame = context.top();
-      auto& frame_inst = program.script.at(frame.ip);
-
       // Check if block is inside a FOR loop
-      if (frame_inst.opcode != "FOR")
+      if (program.opcode_at(frame.ip) != "FOR")
         throw runtime_error("[ENDFOR] No matching FOR block on stack.");
 
       // Cache exit address if it's not set
       if (inst.exit == 0)
-        inst.exit = program.ip + 1;
+        program.set_exit(program.ip, program.ip + 1);
 
       // Decrement loop count; jump back if more iterations remain
       if (--frame.ctr > 0)
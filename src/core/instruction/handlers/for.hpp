@@ -15,20 +15,19 @@ auto make_for() -> InstructionHandler {
     if (inst.exit != 0)
       return void(program.set_ip(inst.exit));
       
-    auto& script = program.script;
     auto start = program.ip;
     auto depth = 1u;
 
-    // Otherwise, scan ahead to find the matching ENDFOR
-    for (auto i = start+1u; i < script.size(); ++i) {
-      auto& opcode = script[i].opcode;
+    // Otherwise, scan ahead to find the matching ENDFOR (opcodes only; nothing is paged in)
+    for (auto i = start+1u; i < program.size(); ++i) {
+      auto& opcode = program.opcode_at(i);
       int delta = (opcode == "FOR") - (opcode == "ENDFOR");
       depth += delta;
       
       // If matching ENDFOR is found, cache exit address and exit loop
       if (depth == 0) {
-        inst.exit = i + 1;
-        program.set_ip(inst.exit);
+        program.set_exit(start, i + 1);
+        program.set_ip(i + 1);
         return;
       }
     }
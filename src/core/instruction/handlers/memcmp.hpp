@@ -0,0 +1,51 @@
+#pragma once
+#include "core/instruction/Instruction.hpp"
+#include "core/instruction/InstructionHandler.hpp"
+#include "core/process/ProcessData.hpp"
+
+/**
+ * @brief Implements the MEMCMP instruction.
+ * 
+ * Syntax: `MEMCMP var a b len` → compares `len` bytes at `a` and `b` and stores
+ * 0 if equal, 1 if `a` sorts after `b`, or 65535 (-1 as uint16) if before.
+ * - Every page of both ranges is faulted in first; on a fault the instruction retries.
+ * - The first signature stays inside the 64-byte minimum process size for random generation.
+ */
+auto make_memcmp() -> InstructionHandler {
+  return InstructionHandler()
+    .set_opcode("MEMCMP")
+    .add_signature(Signature().Var().Uint(0,31).Uint(0,31).Uint(1,32))
+    .add_signature(Signature().Var().Uint16().Uint16().Uint(1,65535).Manual())
+
+    .set_execute([](Instruction& inst, ProcessData& process) {
+      auto& program = process.program;
+      auto& memory = process.memory;
+
+      auto var = inst.args[0];
+      auto lhs = stoul(inst.args[1], nullptr, 0);
+      auto rhs = stoul(inst.args[2], nullptr, 0);
+      auto len = stoul(inst.args[3], nullptr, 0);
+
+      auto [order, is_violation, is_page_fault] = memory.virtual_memory.compare_range(lhs, rhs, len);
+
+      if (is_violation) {
+        process.log(format("[MEMCMP] access violation comparing {} bytes 0x{:X} and 0x{:X}", len, lhs, rhs));
+        program.terminate();
+        return;
+      }
+
+      if (is_page_fault) {
+        process.log("[MEMCMP] Unable to resolve page fault on first try.");
+        program.set_ip(program.ip);
+        return;
+      }
+
+      auto [set_violation, set_fault, is_full] = memory.set(var, cast<uint>(order) & 0xFFFF);
+      if (set_violation)
+        process.log(format("[MEMCMP] write violation for '{}'", var));
+      else if (set_fault) {
+        process.log(format("[MEMCMP] Unable to resolve page fault on first try for '{}'", var));
+        program.set_ip(program.ip);
+      }
+    });
+}
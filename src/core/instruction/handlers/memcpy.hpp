@@ -0,0 +1,42 @@
+#pragma once
+#include "core/instruction/Instruction.hpp"
+#include "core/instruction/InstructionHandler.hpp"
+#include "core/process/ProcessData.hpp"
+
+/**
+ * @brief Implements the MEMCPY instruction.
+ * 
+ * Syntax: `MEMCPY dst src len` → copies `len` bytes from `src` to `dst` (memmove semantics).
+ * - Every page of both ranges is faulted in first; on a fault the instruction retries.
+ * - Bytes move a page-sized chunk at a time instead of two bytes per translation.
+ * - The first signature stays inside the 64-byte minimum process size for random generation.
+ */
+auto make_memcpy() -> InstructionHandler {
+  return InstructionHandler()
+    .set_opcode("MEMCPY")
+    .add_signature(Signature().Uint(0,31).Uint(0,31).Uint(1,32))
+    .add_signature(Signature().Uint16().Uint16().Uint(1,65535).Manual())
+
+    .set_execute([](Instruction& inst, ProcessData& process) {
+      auto& program = process.program;
+      auto& memory = process.memory;
+
+      auto dst = stoul(inst.args[0], nullptr, 0);
+      auto src = stoul(inst.args[1], nullptr, 0);
+      auto len = stoul(inst.args[2], nullptr, 0);
+
+      auto [is_violation, is_page_fault] = memory.virtual_memory.copy_range(dst, src, len);
+
+      if (is_violation) {
+        process.log(format("[MEMCPY] access violation copying {} bytes 0x{:X} → 0x{:X}", len, src, dst));
+        program.terminate();
+        return;
+      }
+
+      if (is_page_fault) {
+        process.log("[MEMCPY] Unable to resolve page fault on first try.");
+        program.set_ip(program.ip);
+        return;
+      }
+    });
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include "core/instruction/Instruction.hpp"
+#include "core/instruction/InstructionHandler.hpp"
+#include "core/process/ProcessData.hpp"
+
+/**
+ * @brief Implements the MEMSET instruction.
+ * 
+ * Syntax: `MEMSET dst value len` → sets `len` bytes at `dst` to the byte `value`.
+ * - Every page of the range is faulted in first; on a fault the instruction retries.
+ * - The first signature stays inside the 64-byte minimum process size for random generation.
+ */
+auto make_memset() -> InstructionHandler {
+  return InstructionHandler()
+    .set_opcode("MEMSET")
+    .add_signature(Signature().Uint(0,31).Uint8().Uint(1,32))
+    .add_signature(Signature().Uint16().Uint8().Uint(1,65535).Manual())
+
+    .set_execute([](Instruction& inst, ProcessData& process) {
+      auto& program = process.program;
+      auto& memory = process.memory;
+
+      auto dst   = stoul(inst.args[0], nullptr, 0);
+      auto value = stoul(inst.args[1], nullptr, 0);
+      auto len   = stoul(inst.args[2], nullptr, 0);
+
+      auto [is_violation, is_page_fault] = memory.virtual_memory.fill_range(dst, value, len);
+
+      if (is_violation) {
+        process.log(format("[MEMSET] access violation setting {} bytes at 0x{:X}", len, dst));
+        program.terminate();
+        return;
+      }
+
+      if (is_page_fault) {
+        process.log("[MEMSET] Unable to resolve page fault on first try.");
+        program.set_ip(program.ip);
+        return;
+      }
+    });
+}
@@ -8,6 +8,7 @@ auto make_sleep() -> InstructionHandler {
   return InstructionHandler()
     .set_opcode("SLEEP")
     .add_signature(Signature().Uint(0,3))
+    .add_signature(Signature().Uint8().Manual())
 
     .set_execute([](Instruction& inst, ProcessData& process) {
       auto ticks = stoul(inst.args[0]);
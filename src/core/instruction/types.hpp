@@ -22,7 +22,8 @@ class Signature {
   public:
 
   Signature(): 
-    args(vec<Arg>()) {}   // Initializes an empty signature
+    args        (vec<Arg>()),  // Initializes an empty signature
+    generatable (true) {}      // Whether generate() may produce this signature
 
   // === Builders ===
 
@@ -41,6 +42,9 @@ class Signature {
   /** @brief Adds an unsigned 16-bit integer argument (0–65535). */
   auto Uint16() -> Signature& { return Uint(0, 65535); }
 
+  /** @brief Accepts this signature in user scripts but never generates it randomly. */
+  auto Manual() -> Signature& { return generatable = false, *this; }
+
   // === Accessors ===
 
   /** @brief Returns the full list of argument specs. */
@@ -49,6 +53,9 @@ class Signature {
   /** @brief Returns the number of arguments in the signature. */
   auto size() -> uint { return args.size(); }
 
+  /** @brief Returns false if this signature is only accepted from user scripts. */
+  auto is_generatable() -> bool { return generatable; }
+
   // === Generator (optional utility) ===
 
   /** @brief Generates a list of example argument values matching the signature. */
@@ -96,6 +103,7 @@ class Signature {
 
   // ------ Instance variables ------
   vec<Arg> args;
+  bool generatable;
 
   // ------ Constants ------
   inline static auto messages = vec<str>{ "hello", "world", "lorem", "ipsum", "test" };
@@ -0,0 +1,429 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+
+
+/**
+ * @brief Per-process swap files for evicted pages, serviced by a small pool of I/O worker threads.
+ *
+ * Responsibilities:
+ * - Gives each process its own swap extent (file), created on its first eviction.
+ *   A page lives at offset `page_num * page_size` in its owner's file.
+ * - Buffers page writes and flushes them from worker threads, outside the global lock.
+ * - Coalesces writes to adjacent pages of the same process into a single file write.
+ * - Performs reads asynchronously and queues their completion callbacks.
+ * - Reclaims a finished process's extent in bulk by unlinking its file.
+ *
+ * Key Behaviors:
+ * - A read of a page whose write is still buffered or in flight is served from memory.
+ * - Completion callbacks never run on a worker; `poll()` runs them on the caller's
+ *   thread (the simulation, under the global lock), which is where pages become resident.
+ * - Reading a page leaves it stored, so a page evicted again unmodified needs no write;
+ *   releasing a process drops all of its pages at once.
+ *
+ * Design Notes:
+ * - Keys are `(pid << 32) | page_num`, so ordered maps keep a process's pages adjacent.
+ * - A page is never part of two in-flight writes, so batches can't reorder stale data.
+ * - A file is only unlinked once no worker is using it (safe on Windows too).
+ * - `csopesy-backing-store.txt` is only regenerated on request (`snapshot()`), since
+ *   it reads back every stored page; flushes and releases never pay for it.
+ */
+class BackingStore {
+  public:
+  using Bytes = vec<uint>;
+  using Callback = func<void(Bytes)>;
+
+  static constexpr uint WORKER_COUNT = 2;    ///< Number of I/O worker threads
+  static constexpr uint MAX_BATCH    = 16;   ///< Maximum adjacent pages coalesced into one write
+
+  BackingStore():
+    page_size     (0u),                             // Bytes per page
+    dir           (""s),                            // Directory holding the per-process swap files
+    extents       (umap<uint,set<uint>>()),         // pid: page numbers currently stored for it
+    stored        (0u),                             // Total number of stored pages
+    pending       (ordered_map<uint64,Bytes>()),    // Buffered writes not yet taken by a worker (key-ordered)
+    inflight      (ordered_map<uint64,Bytes>()),    // Writes currently being flushed by a worker
+    reads         (deque<tup<uint64,Callback>>()),  // Queued file reads: (key, callback)
+    completions   (deque<tup<Callback,Bytes>>()),   // Finished reads waiting for poll()
+    unlinks       (vec<uint>()),                    // Released pids whose files await deletion
+    busy          (umap<uint,uint>()),              // pid: number of worker operations using its file
+    num_batches   (0u),                             // Number of file writes issued
+    num_written   (0u),                             // Number of pages written to files
+    num_read      (0u),                             // Number of pages read from files
+    num_unlinked  (0u),                             // Number of swap files reclaimed
+    running       (false),                          // Whether the workers should keep running
+    io_mtx        (),                               // Guards all state above (never the global lock)
+    cv            (),                               // Wakes workers when work arrives
+    workers       (vec<Thread>()) {}                // I/O worker pool
+
+  ~BackingStore() { stop(); }
+
+  /** @brief Resets the store, clears the swap directory, and starts the worker pool. */
+  void init(uint page_bytes, str directory="csopesy-swap") {
+    stop();
+
+    page_size = page_bytes;
+    dir = move(directory);
+    extents.clear();
+    stored = 0;
+    pending.clear();
+    inflight.clear();
+    reads.clear();
+    completions.clear();
+    unlinks.clear();
+    busy.clear();
+    num_batches = 0;
+    num_written = 0;
+    num_read = 0;
+    num_unlinked = 0;
+
+    // Start from an empty swap directory
+    auto error = std::error_code();
+    fs::remove_all(dir, error);
+    fs::create_directories(dir, error);
+
+    running = true;
+    for (auto i = 0u; i < WORKER_COUNT; ++i)
+      workers.emplace_back([this] { work(); });
+  }
+
+  /** @brief Returns true if the given page is currently stored. */
+  auto contains(uint64 key) -> bool {
+    auto lock = lock_guard(io_mtx);
+    auto it = extents.find(pid_of(key));
+    return it != extents.end() && it->second.contains(page_of(key));
+  }
+
+  /** @brief Returns the number of stored pages. */
+  auto size() -> uint {
+    auto lock = lock_guard(io_mtx);
+    return stored;
+  }
+
+  /** @brief Returns the number of processes that currently own a swap extent. */
+  auto extent_count() -> uint {
+    auto lock = lock_guard(io_mtx);
+    return extents.size();
+  }
+
+  /**
+   * @brief Returns a copy of every stored page, ordered by key.
+   * Blocks while flushed pages are read back from their swap files.
+   */
+  auto entries() -> ordered_map<uint64,Bytes> {
+    auto lock = unique_lock(io_mtx);
+    return gather(lock);
+  }
+
+  /** @brief Queues a page write. Returns immediately; a worker flushes it later. */
+  void write(uint64 key, Bytes bytes) {
+    auto lock = lock_guard(io_mtx);
+    if (extents[pid_of(key)].insert(page_of(key)).second)
+      ++stored;
+
+    pending[key] = move(bytes);
+    cv.notify_one();
+  }
+
+  /**
+   * @brief Reads a stored page (it stays stored).
+   * The callback runs during a later `poll()` with the page contents.
+   */
+  void read(uint64 key, Callback done) {
+    auto lock = lock_guard(io_mtx);
+
+    // Still buffered or being flushed: serve a copy from memory
+    if (auto it = pending.find(key); it != pending.end()) {
+      completions.emplace_back(move(done), it->second);
+      return;
+    }
+    if (auto it = inflight.find(key); it != inflight.end()) {
+      completions.emplace_back(move(done), it->second);
+      return;
+    }
+
+    reads.emplace_back(key, move(done));
+    cv.notify_one();
+  }
+
+  /** @brief Drops a stored page without reading it. */
+  void erase(uint64 key) {
+    auto lock = lock_guard(io_mtx);
+    forget(key);
+    pending.erase(key);
+  }
+
+  /**
+   * @brief Drops every page of a process and queues its swap file for deletion.
+   * Cost depends only on that process's buffered work, not on total store size.
+   */
+  void release(uint pid) {
+    auto lock = lock_guard(io_mtx);
+    auto it = extents.find(pid);
+    if (it == extents.end()) return;
+
+    stored -= it->second.size();
+    extents.erase(it);
+
+    // Drop buffered writes and queued reads that targeted this process
+    auto first = pending.lower_bound(make_key(pid, 0));
+    auto last  = pending.upper_bound(make_key(pid, UINT_MAX));
+    pending.erase(first, last);
+    erase_if(reads, [&](auto& req) {
+      auto& [key, _] = req;
+      return pid_of(key) == pid;
+    });
+
+    unlinks.push_back(pid);
+    cv.notify_one();
+  }
+
+  /**
+   * @brief Regenerates 'csopesy-backing-store.txt' from every stored page.
+   * Costs one read per flushed page, so it only runs when asked for (vmstat -store).
+   */
+  void snapshot() {
+    auto lock = unique_lock(io_mtx);
+    write_snapshot(lock);
+  }
+
+  /** @brief Runs the callbacks of all finished reads on the calling thread. */
+  void poll() {
+    auto done = deque<tup<Callback,Bytes>>();
+    {
+      auto lock = lock_guard(io_mtx);
+      if (completions.empty()) return;
+      swap(done, completions);
+    }
+
+    for (auto& [callback, bytes] : done)
+      callback(move(bytes));
+  }
+
+  /** @brief Stops and joins all workers. Unflushed writes are discarded. */
+  void stop() {
+    {
+      auto lock = lock_guard(io_mtx);
+      running = false;
+    }
+    cv.notify_all();
+
+    for (auto& worker : workers)
+      if (worker.joinable())
+        worker.join();
+    workers.clear();
+  }
+
+  /** @brief Computes the store key of a process-page pair. */
+  static auto make_key(uint pid, uint page_num) -> uint64 { return (cast<uint64>(pid) << 32) | page_num; }
+
+  /** @brief Extracts the pid from a store key. */
+  static auto pid_of(uint64 key) -> uint { return key >> 32; }
+
+  /** @brief Extracts the page number from a store key. */
+  static auto page_of(uint64 key) -> uint { return key & 0xFFFFFFFF; }
+
+  // ------ Member variables ------
+  uint page_size;
+  str dir;
+  umap<uint,set<uint>> extents;
+  uint stored;
+  ordered_map<uint64,Bytes> pending;
+  ordered_map<uint64,Bytes> inflight;
+  deque<tup<uint64,Callback>> reads;
+  deque<tup<Callback,Bytes>> completions;
+  vec<uint> unlinks;
+  umap<uint,uint> busy;
+  atomic_uint num_batches;
+  atomic_uint num_written;
+  atomic_uint num_read;
+  atomic_uint num_unlinked;
+  bool running;
+  mutex io_mtx;
+  condition_variable cv;
+  vec<Thread> workers;
+
+  // ------ Internal helpers ------
+  private:
+
+  /** @brief Worker loop: serves reads first, then reclaims files, then flushes write batches. */
+  void work() {
+    auto lock = unique_lock(io_mtx);
+
+    while (true) {
+      cv.wait(lock, [&] { return !running || !reads.empty() || has_unlinkable() || has_flushable_write(); });
+      if (!running) return;
+
+      // Reads first: a core is waiting on them
+      if (!reads.empty()) {
+        auto [key, done] = move(reads.front());
+        reads.pop_front();
+        ++busy[pid_of(key)];
+
+        lock.unlock();
+        auto bytes = read_page(key);
+        lock.lock();
+
+        unbusy(pid_of(key));
+        ++num_read;
+        completions.emplace_back(move(done), move(bytes));
+        continue;
+      }
+
+      // Reclaim released extents in bulk
+      if (has_unlinkable()) {
+        auto it = find_if(unlinks, [&](uint pid) { return !busy.contains(pid); });
+        auto pid = *it;
+        unlinks.erase(it);
+
+        lock.unlock();
+        auto error = std::error_code();
+        fs::remove(path_of(pid), error);
+        lock.lock();
+
+        ++num_unlinked;
+        continue;
+      }
+
+      // Take a run of adjacent pages and flush them as one write
+      auto [first, buffer] = take_batch();
+      auto count = buffer.size() / page_size;
+      auto pid = pid_of(first);
+      ++busy[pid];
+
+      lock.unlock();
+      auto file = open_extent(pid);
+      file.seekp(cast<std::streamoff>(page_of(first)) * page_size);
+      file.write(buffer.data(), buffer.size());
+      file.close();
+      lock.lock();
+
+      for (auto key = first; key < first + count; ++key)
+        inflight.erase(key);
+      unbusy(pid);
+      ++num_batches;
+      num_written += count;
+      cv.notify_all();  // Writes held back behind this batch may now be flushable
+    }
+  }
+
+  /** @brief Returns true if a released file is no longer used by any worker. */
+  auto has_unlinkable() -> bool {
+    return any_of(unlinks, [&](uint pid) { return !busy.contains(pid); });
+  }
+
+  /** @brief Returns true if a buffered write targets a page that isn't being flushed. */
+  auto has_flushable_write() -> bool {
+    return any_of(pending, [&](auto& entry) { return !inflight.contains(entry.first); });
+  }
+
+  /** @brief Moves the first run of adjacent flushable pages into `inflight`. Returns (first key, file bytes). */
+  auto take_batch() -> tup<uint64, vec<char>> {
+    auto it = find_if(pending, [&](auto& entry) { return !inflight.contains(entry.first); });
+    auto first = it->first;
+    auto buffer = vec<char>();
+
+    // Keys of one process are contiguous, so key + 1 is the next page of the same file
+    for (auto key = first; it != pending.end() && it->first == key && key - first < MAX_BATCH; ++key) {
+      if (inflight.contains(key) || pid_of(key) != pid_of(first)) break;
+
+      for (auto value : it->second)
+        buffer.push_back(cast<char>(value & 0xFF));
+
+      inflight[key] = move(it->second);
+      it = pending.erase(it);
+    }
+
+    return {first, move(buffer)};
+  }
+
+  /** @brief Reads one page from its owner's swap file (no lock held). */
+  auto read_page(uint64 key) -> Bytes {
+    auto buffer = vec<char>(page_size, 0);
+    auto file = std::ifstream(path_of(pid_of(key)), ios::binary);
+    file.seekg(cast<std::streamoff>(page_of(key)) * page_size);
+    file.read(buffer.data(), buffer.size());  // A short read leaves zeros
+
+    auto bytes = Bytes(page_size);
+    for (auto i = 0u; i < page_size; ++i)
+      bytes[i] = cast<uchar>(buffer[i]);
+    return bytes;
+  }
+
+  /** @brief Opens a process's swap file for writing, creating it on first use. */
+  auto open_extent(uint pid) -> std::fstream {
+    auto path = path_of(pid);
+    auto file = std::fstream(path, ios::in | ios::out | ios::binary);
+    if (file.is_open()) return file;
+
+    ofstream(path, ios::binary).close();
+    return std::fstream(path, ios::in | ios::out | ios::binary);
+  }
+
+  /** @brief Returns the swap file path for a process. */
+  auto path_of(uint pid) -> str { return format("{}/pid-{}.bin", dir, pid); }
+
+  /** @brief Removes a page from its extent's bookkeeping (does not touch buffers). */
+  void forget(uint64 key) {
+    auto it = extents.find(pid_of(key));
+    if (it != extents.end() && it->second.erase(page_of(key)))
+      --stored;
+  }
+
+  /** @brief Drops one worker reference to a process's file. */
+  void unbusy(uint pid) {
+    if (--busy[pid] == 0)
+      busy.erase(pid);
+  }
+
+  /**
+   * @brief Collects a copy of every stored page, ordered by key.
+   * Buffered pages are copied from memory; flushed pages are read back without the lock.
+   */
+  auto gather(unique_lock<mutex>& lock) -> ordered_map<uint64,Bytes> {
+    auto buffered = ordered_map<uint64, opt<Bytes>>();
+    auto gathered_pids = vec<uint>();
+    for (auto& [pid, pages] : extents) {
+      for (auto page : pages) {
+        auto key = make_key(pid, page);
+        if (auto it = pending.find(key); it != pending.end())
+          buffered[key] = it->second;
+        else if (auto it = inflight.find(key); it != inflight.end())
+          buffered[key] = it->second;
+        else
+          buffered[key] = nullopt;
+      }
+      ++busy[pid];  // Keep the file from being unlinked while it's read back
+      gathered_pids.push_back(pid);
+    }
+
+    lock.unlock();
+    auto entries = ordered_map<uint64,Bytes>();
+    for (auto& [key, bytes] : buffered)
+      entries[key] = bytes ? move(*bytes) : read_page(key);
+    lock.lock();
+
+    for (auto pid : gathered_pids)
+      unbusy(pid);
+    return entries;
+  }
+
+  /** @brief Regenerates 'csopesy-backing-store.txt' (written without the lock). */
+  void write_snapshot(unique_lock<mutex>& lock) {
+    auto entries = gather(lock);
+
+    lock.unlock();
+    auto out = ofstream("csopesy-backing-store.txt", ios::trunc);
+    out << "[Backing Store Snapshot]\n";
+
+    for (auto& [key, bytes] : entries) {
+      out << format("key={} pid={} page={} [", key, pid_of(key), page_of(key));
+      for (auto i = 0u; i < bytes.size(); ++i) {
+        out << format("{:04x}", bytes[i]);
+        if (i != bytes.size() - 1) out << " ";
+      }
+      out << "]\n";
+    }
+    out.close();
+    lock.lock();
+  }
+};
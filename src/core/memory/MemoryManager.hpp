@@ -17,38 +17,268 @@ class MemoryManager {
    * @param memory_capacity Total memory size in bytes.
    * @param page_size       Size of each page/frame in bytes.
    * @param is_preempted    Optional predicate function that returns true if a given PID is preempted.
+   * @param swap_dir        Directory for the per-process swap files (cleared on init).
    */
-  void init(uint memory_capacity, uint page_size, func<bool(uint)> is_preempted=nullptr) {    
+  void init(uint memory_capacity, uint page_size, func<bool(uint)> is_preempted=nullptr, str swap_dir="csopesy-swap") {    
     data.page_size = page_size;
     data.frame_count = memory_capacity / page_size;
+    data.fast_frames = data.frame_count;  // Single tier until set_tiers()
     data.memory = vec<uint>(memory_capacity, 0);
 
     // Store the preemption-check callback
     data.is_preempted = move(is_preempted);
   
-    // Reset and repopulate the free frame list
-    data.free_frames.clear(); 
-    for (auto i=0u; i < data.frame_count; ++i)
-      data.free_frames.push_back(i);
+    // Reset and repopulate the free frame pools
+    reset_free_frames();
+    data.frame_table.assign(data.frame_count, nullopt);
 
-    // Clear all process page tables
+    // Clear all process page tables (and the eviction order that refers to them)
     data.page_table_map.clear();
+    data.equeue.clear();
+    data.run_distance.clear();
+
+    // Start the backing store and its I/O workers
+    data.store.init(page_size, move(swap_dir));
+
+    // Fresh counters, plus gauges sampled whenever the stats are rendered
+    auto& stats = data.stats;
+    stats.reset();
+    stats.add_gauge("frames.free",         [this] { return data.free_count(); });
+    stats.add_gauge("frames.used",         [this] { return data.frame_count - data.free_count(); });
+    stats.add_gauge("frames.largest_free_run", [this] { return largest_free_run(); });
+    stats.add_gauge("page_tables.bytes",   [this] { return get_page_table_memory(); });
+    stats.add_gauge("store.pages",         [this] { return data.store.size(); });
+    stats.add_gauge("store.bytes",         [this] { return uint64(data.store.size()) * data.page_size; });
+    stats.add_gauge("store.extents",       [this] { return data.store.extent_count(); });
+    stats.add_gauge("store.batches",       [this] { return data.store.num_batches.load(); });
+    stats.add_gauge("store.bytes_written", [this] { return uint64(data.store.num_written) * data.page_size; });
+    stats.add_gauge("store.bytes_read",    [this] { return uint64(data.store.num_read) * data.page_size; });
+  }
+
+  /**
+   * @brief Configures huge pages.
+   *
+   * @param factor  Base pages per huge page; a huge page is backed by an aligned run of this many frames.
+   * @param enabled Whether processes use huge pages by default (they can still opt in individually).
+   */
+  void set_huge_pages(uint factor, bool enabled) {
+    data.huge_factor = factor;
+    data.huge_default = enabled;
+  }
+
+  /**
+   * @brief Configures the simulated NUMA topology. Must be called while no frames are in use.
+   *
+   * @param nodes       Number of nodes; frames are split into that many equal contiguous pools.
+   * @param policy      "first-touch" (allocate on the faulting core's node) or "interleave" (spread pages by page number).
+   * @param remote_cost Extra cycles charged to a process for each access to another node's frame.
+   * @param node_of     Returns the node of the core a pid is running on.
+   */
+  void set_numa(uint nodes, const str& policy, uint remote_cost, func<uint(uint)> node_of) {
+    data.numa_nodes = clamp(nodes, 1u, max(1u, data.frame_count));
+    data.numa_interleave = policy == "interleave";
+    data.numa_remote_cost = remote_cost;
+    data.node_of = move(node_of);
+    reset_free_frames();
+  }
+
+  /**
+   * @brief Selects how a victim is chosen when a fault finds no free frame.
+   *
+   * - "fifo":        the faulting process replaces its own oldest page.
+   * - "global-fifo": the oldest resident page of any process is replaced.
+   * - "hinted":      the oldest page of the process furthest from running is
+   *                  replaced, using the distances from publish_run_hints().
+   */
+  void set_replacement(const str& policy) { data.replacement = policy; }
+
+  /** @brief Returns true if the replacement policy uses publish_run_hints() (only "hinted" does). */
+  auto wants_run_hints() -> bool { return data.replacement == "hinted"; }
+
+  /**
+   * @brief Publishes how soon each running and ready process will run: 0 for
+   *        running processes, then their ready-queue position. Sleepers are
+   *        placed after `behind`, further the longer they sleep, but only when
+   *        replacement looks one up (see set_sleep_hints()), so publishing
+   *        never walks the sleepers. Other processes count as furthest from running.
+   */
+  void publish_run_hints(umap<uint,uint> distances, uint behind) {
+    data.run_distance = move(distances);
+    data.run_behind = behind;
+  }
+
+  /** @brief Sets the lookup giving the ticks until a sleeping pid wakes (nullopt if it isn't sleeping). */
+  void set_sleep_hints(func<opt<uint>(uint)> sleep_left) { data.sleep_left = move(sleep_left); }
+
+  /**
+   * @brief Records the pages a process referenced during its time slice as its working set.
+   *        Called when the process leaves its core; clears the reference bits for the next slice.
+   */
+  void record_working_set(uint pid) {
+    auto it = data.page_table_map.find(pid);
+    if (it == data.page_table_map.end()) return;
+
+    auto& table = it->second;
+    table.working_set.clear();
+    for (auto page_num : table.pages()) {
+      auto& page = table.get(page_num);
+      if (!page.referenced) continue;
+      page.referenced = false;
+      table.working_set.push_back(page_num);
+    }
+  }
+
+  /**
+   * @brief Loads the last recorded working set of a process before it runs again.
+   *
+   * Free frames are used first. When memory is full, hinted replacement may
+   * evict pages of processes that run later than this one; the other policies
+   * never evict on speculation. The resident-set cap is respected. Pages
+   * swapped out are read back in one batch of asynchronous store reads, so
+   * they land while the process runs.
+   *
+   * @return The number of pages brought in or started.
+   */
+  auto prefetch_working_set(uint pid) -> uint {
+    auto it = data.page_table_map.find(pid);
+    if (it == data.page_table_map.end()) return 0;
+
+    poll();
+    auto& table = it->second;
+    auto count = 0u;
+    for (auto page_num : table.working_set) {
+      auto& page = table.get(page_num);
+      if (page.has_frame()) continue;
+
+      if (table.over_cap() || (data.free_count() == 0 && !reclaim_for_prefetch(pid))) {
+        data.stats.add("prefetch.skipped");
+        continue;
+      }
+      load(pid, page_num, "prefetch");
+      ++count;
+    }
+    data.stats.add("prefetch.pages", count);
+    return count;
+  }
+
+  /**
+   * @brief Moves the whole resident set of a process to the backing store.
+   *
+   * All dirty pages are queued to the store together, so each run of
+   * adjacent pages is flushed as one batched write. Reads still in flight
+   * are cancelled: their pages are still stored, so they only give back the
+   * frame they reserved. Both kinds become the working set that swap_in()
+   * brings back.
+   *
+   * @return The number of pages released.
+   */
+  auto swap_out(uint pid) -> uint {
+    auto it = data.page_table_map.find(pid);
+    if (it == data.page_table_map.end() || it->second.swapped) return 0;
+
+    poll();  // Land finished reads so they are evicted like any resident page
+    auto& table = it->second;
+    auto loading = vec<uint>();
+    for (auto page_num : table.pages()) {
+      auto& page = table.get(page_num);
+      if (!page.is_loading()) continue;
+      free_frame(page.frame_num.value());
+      page.frame_num = nullopt;
+      page.io_tag = 0;  // The read's completion is now stale and ignored
+      loading.push_back(page_num);
+    }
+
+    auto positions = umap<uint,uint>();  // Page → its slot in the eviction queue
+    for (auto i = 0u; i < data.equeue.size(); ++i)
+      if (get<0>(data.equeue[i]) == pid)
+        positions[get<1>(data.equeue[i])] = i;
+
+    auto victims = vec<uint>();
+    for (auto page_num : table.pages())
+      if (positions.contains(page_num) && table.get(page_num).is_loaded())
+        victims.push_back(page_num);
+
+    // Evict back to front so the remaining queue positions stay valid
+    auto order = victims;
+    std::ranges::sort(order, std::greater<>(), [&](uint page_num) { return positions[page_num]; });
+    for (auto page_num : order)
+      evict(data.equeue.begin() + positions[page_num]);
+
+    victims.insert(victims.end(), loading.begin(), loading.end());
+    table.working_set = move(victims);
+    table.swapped = true;
+    data.stats.add("swap.outs");
+    data.stats.add("swap.pages_out", table.working_set.size());
+    return table.working_set.size();
   }
 
-  auto create_memory_view_for(uint pid, uint bytes_needed=64u) -> MemoryView {
+  /** @brief Starts bringing a swapped-out process back in (see prefetch_working_set). */
+  void swap_in(uint pid) {
+    auto it = data.page_table_map.find(pid);
+    if (it == data.page_table_map.end() || !it->second.swapped) return;
+
+    it->second.swapped = false;
+    prefetch_working_set(pid);
+    data.stats.add("swap.ins");
+  }
+
+  /** @brief Returns true if the process's resident set is swapped out. */
+  auto is_swapped(uint pid) -> bool {
+    auto it = data.page_table_map.find(pid);
+    return it != data.page_table_map.end() && it->second.swapped;
+  }
+
+  /** @brief Returns true if the replacement policy lets a fault take frames from other processes. */
+  auto allows_stealing() -> bool { return data.replacement == "global-fifo" || data.replacement == "hinted"; }
+
+  /** @brief Returns true if a fault could take a frame from another process (non-local replacement). */
+  auto can_steal_frame() -> bool {
+    if (!allows_stealing())
+      return false;
+    return std::ranges::any_of(data.equeue, [&](auto& entry) { return evictable(entry); });
+  }
+
+  /**
+   * @brief Splits the frames into a fast tier and a slow tier.
+   *
+   * @param slow_frames Number of frames in the slow tier (the highest-numbered ones; 0 = single tier).
+   * @param slow_cost   Extra cycles charged to a process for each access to a slow-tier frame.
+   */
+  void set_tiers(uint slow_frames, uint slow_cost) {
+    data.fast_frames = data.frame_count - min(slow_frames, data.frame_count);
+    data.slow_cost = slow_cost;
+  }
+
+  /** @brief Sets the resident-set cap, in bytes, given to new processes (0 = unlimited). */
+  void set_default_rss_cap(uint bytes) { data.default_rss_cap = rss_frames_for(bytes); }
+
+  /** @brief Overrides the resident-set cap, in bytes, of one process (0 = unlimited). */
+  void set_rss_cap(uint pid, uint bytes) {
+    if (auto it = data.page_table_map.find(pid); it != data.page_table_map.end())
+      it->second.rss_cap = rss_frames_for(bytes);
+  }
+
+  /**
+   * @brief Returns a view over the address space of a process, declaring it on first use.
+   * @param huge Back this process with huge pages even if they are off by default.
+   */
+  auto create_memory_view_for(uint pid, uint bytes_needed=64u, bool huge=false) -> MemoryView {
     // Enforce minimum size of 64 bytes (symbol table)
     if (bytes_needed < 64u)
       bytes_needed = 64u;
 
     // Auto-allocate if not yet allocated
     if (!data.page_table_map.contains(pid))
-      alloc(pid, bytes_needed);  // Auto-alloc with minimum default
+      alloc(pid, bytes_needed, huge || data.huge_default);  // Auto-alloc with minimum default
 
     return MemoryView(pid, data, [this](uint pid, uint page_num) {
       return this->page_in(pid, page_num);
     });
   }
 
+  /** @brief Applies finished backing-store reads, marking their pages resident. */
+  void poll() { data.store.poll(); }
+
   /**
    * @brief Releases all memory used by a given process.
    *
@@ -61,18 +291,22 @@ class MemoryManager {
 
     auto& page_table = data.page_table_map.at(pid);
 
-    // Free any frames currently in use
+    // Free any frames currently in use (including frames reserved for in-flight reads)
     for (auto& page_num : page_table.pages()) {
       auto& page = page_table.get(page_num);
-      if (page.is_loaded()) {
-        data.free_frames.push_back(page.frame());
+      if (page.has_frame()) {
+        free_frame(page.frame());
         page.frame_num = nullopt;
+        page.io_tag = 0;
       }
     }
 
     // Remove from page table
     data.page_table_map.erase(pid);
 
+    // Reclaim the process's swap extent in one go
+    data.store.release(pid);
+
     // Remove from eviction queue
     erase_if(data.equeue, [&](auto& entry) {
       auto [entry_pid, _] = entry;
@@ -90,30 +324,295 @@ class MemoryManager {
  *   - "free" if the frame is unused
  */
   auto render_layout() -> str {
-    // Create reverse map: frame_num → (pid, page_num)
-    auto frame_map = umap<uint, tup<uint, uint>>();
+    auto out = osstream();
+    out << "\n[Physical Memory Layout]\n";
+    for (auto i = 0u; i < data.frame_count; ++i) {
+      auto& owner = data.frame_table[i];
+      if (!owner)
+        out << format("[frame {:>2}] → free\n", i);
+      else {
+        auto [pid, page_num] = *owner;
+        auto* page = data.page_table_map.at(pid).find(page_num);
+        auto huge = page && page->huge ? " (huge)" : "";
+        out << format("[frame {:>2}] → pid={:<3} page={}{}\n", i, pid, page_num, huge);
+      }
+    }
 
-    for (auto& [pid, table] : data.page_table_map) {
+    return out.str();
+  }
+
+  /** @brief Halves every page's access counter so the heatmap reflects recent behaviour. */
+  void decay_heat() {
+    for (auto& [_, table] : data.page_table_map)
+      for (auto page_num : table.pages())
+        table.get(page_num).heat >>= 1;
+  }
+
+  /**
+   * @brief Renders the page access heatmap.
+   *
+   * Shows, per process, its hottest and coldest resident pages, followed by a
+   * histogram of all physical frames bucketed by the heat of the page they hold.
+   */
+  auto render_heatmap(uint top=3) -> str {
+    static const auto buckets = vec<tup<str,uint>>{
+      { "0",     0u },  { "1-3",   1u },  { "4-15",  4u },
+      { "16-63", 16u }, { "64+",   64u },
+    };
+    auto histogram = vec<uint>(buckets.size(), 0u);
+    auto out = osstream();
+
+    out << "\n[Page Heatmap]\n";
+    for (auto& pid : sorted_pids()) {
+      auto& table = data.page_table_map.at(pid);
+
+      // Collect (heat, page) for resident pages, hottest first
+      auto resident = vec<tup<uint,uint>>();
       for (auto page_num : table.pages()) {
         auto& page = table.get(page_num);
-        if (page.is_loaded()) {
-          frame_map[page.frame()] = { pid, page_num };
+        if (page.is_loaded())
+          resident.emplace_back(page.heat, page_num);
+      }
+      std::ranges::sort(resident, std::greater());
+
+      for (auto& [heat, _] : resident) {
+        auto bucket = buckets.size() - 1;
+        while (bucket > 0 && heat < get<1>(buckets[bucket])) --bucket;
+        ++histogram[bucket];
+      }
+
+      auto render = [&](auto first, auto last) {
+        auto line = ""s;
+        for (auto it = first; it != last; ++it)
+          line += format(" p{}:{}", get<1>(*it), get<0>(*it));
+        return line.empty() ? " -"s : line;
+      };
+
+      auto count = min<uint>(top, resident.size());
+      out << format("pid={:<3} resident={:<3} hot:{}  cold:{}\n", pid, resident.size(),
+        render(resident.begin(), resident.begin() + count),
+        render(resident.rbegin(), resident.rbegin() + count));
+    }
+
+    // Frame utilization histogram (free frames first)
+    auto free_count = data.free_count();
+    auto scale = max(1u, data.frame_count);
+    auto bar = [&](uint n) { return str(n * 40 / scale, '#'); };
+
+    out << "\n[Frame Utilization]\n";
+    out << format("  {:<6} {:>4} {}\n", "free", free_count, bar(free_count));
+    for (auto i = 0u; i < buckets.size(); ++i)
+      out << format("  {:<6} {:>4} {}\n", get<0>(buckets[i]), histogram[i], bar(histogram[i]));
+
+    return out.str();
+  }
+
+  /**
+   * @brief Collapses one region of resident base pages into a huge page (khugepaged-style).
+   *
+   * A region qualifies when all of its pages are resident in a huge-page process.
+   * If its frames are already an aligned run it is simply marked huge; otherwise
+   * its contents are migrated into a free aligned run. At most one region is
+   * promoted per call to bound the copying done on a scheduler tick.
+   *
+   * @return True if a region was promoted.
+   */
+  auto promote_huge_pages() -> bool {
+    auto factor = data.huge_factor;
+    if (factor < 2) return false;
+
+    for (auto& pid : sorted_pids()) {
+      auto& table = data.page_table_map.at(pid);
+      if (!table.huge) continue;
+
+      for (auto base = 0u; base + factor <= table.size(); base += factor) {
+        if (!region_promotable(table, base)) continue;
+
+        // Already backed by an aligned run: nothing to move
+        auto first = table.get(base).frame();
+        auto in_place = first % factor == 0;
+        for (auto i = 1u; in_place && i < factor; ++i)
+          in_place = table.get(base + i).frame() == first + i;
+
+        if (!in_place) {
+          auto run = find_free_run(factor);
+          if (!run) return false;  // Fragmented: no run to migrate into
+          claim_run(*run);
+          table.resident += factor;  // Balanced by freeing the old frames below
+
+          for (auto i = 0u; i < factor; ++i) {
+            auto& page = table.get(base + i);
+            auto from = page.frame() * data.page_size;
+            auto to   = (*run + i) * data.page_size;
+            std::copy_n(data.memory.begin() + from, data.page_size, data.memory.begin() + to);
+            free_frame(page.frame());
+            page.frame_num = *run + i;
+            data.frame_table[*run + i] = tup<uint,uint>{ pid, base + i };
+          }
         }
+
+        for (auto i = 0u; i < factor; ++i)
+          table.get(base + i).huge = true;
+        data.stats.add("huge.promotions");
+        return true;
       }
     }
+    return false;
+  }
 
-    // Render table
-    auto out = osstream();
-    out << "\n[Physical Memory Layout]\n";
-    for (auto i = 0u; i < data.frame_count; ++i) {
-      if (!frame_map.contains(i))
-        out << format("[frame {:>2}] → free\n", i);
+  /**
+   * @brief Defragments free frames by migrating resident pages (kcompactd-style).
+   *
+   * Within each NUMA node (and memory tier) a migrate scanner walks up from the lowest frame
+   * and a free scanner walks down from the highest; each movable page found
+   * below a free frame is moved into it, so free frames collect into one
+   * run at the bottom of the node. Pages being read in and huge pages stay
+   * put. Nothing runs while the free frames are already contiguous.
+   *
+   * @param budget Maximum pages to migrate (rate limit per call).
+   * @return The number of pages migrated.
+   */
+  auto compact(uint budget) -> uint {
+    if (budget == 0 || data.free_count() < 2 || largest_free_run() == data.free_count())
+      return 0;
+
+    // Pages never leave their node or tier, so compact each (node, tier) segment on its own
+    auto segments = vec<tup<uint,uint>>();
+    auto nodes = data.numa_nodes;
+    for (auto node = 0u; node < nodes; ++node) {
+      auto lo = cast<uint>((cast<uint64>(node) * data.frame_count + nodes - 1) / nodes);
+      auto hi = cast<uint>((cast<uint64>(node + 1) * data.frame_count + nodes - 1) / nodes);
+      if (lo < data.fast_frames && data.fast_frames < hi) {
+        segments.push_back({ lo, data.fast_frames });
+        segments.push_back({ data.fast_frames, hi });
+      } else
+        segments.push_back({ lo, hi });
+    }
+
+    auto moved = 0u;
+    for (auto [lo, hi] : segments) {
+      if (moved == budget) break;
+
+      auto migrate = lo, free = hi;
+      while (moved < budget) {
+        while (migrate < free && !movable(migrate)) ++migrate;
+        while (free > migrate && data.frame_table[free - 1]) --free;
+        if (migrate >= free) break;
+
+        migrate_frame(migrate, free - 1);
+        ++moved;
+      }
+    }
+
+    if (moved > 0) {
+      data.stats.add("compaction.passes");
+      data.stats.add("compaction.migrations", moved);
+    }
+    return moved;
+  }
+
+  /**
+   * @brief Moves hot pages into the fast tier and cold pages out of it.
+   *
+   * Slow-tier pages whose heat reached `promote_heat` are promoted, hottest
+   * first, into a free fast frame. When the fast tier is full, the coldest
+   * fast page is demoted by exchanging frames with it, provided it has less
+   * than half the heat of the page replacing it (so pages don't ping-pong).
+   * Heat decays periodically, so pages that cool down drift back out.
+   * Pages never leave their NUMA node: both the free frame and the exchange
+   * partner must be on the hot page's node.
+   *
+   * @param budget       Maximum promotions per call (rate limit).
+   * @param promote_heat Access count at which a slow page counts as hot.
+   * @return The number of pages promoted.
+   */
+  auto balance_tiers(uint budget, uint promote_heat) -> uint {
+    if (!data.tiered() || budget == 0) return 0;
+
+    auto heat_of = [&](uint frame_num) { return page_in_frame(frame_num).heat; };
+    auto hot = vec<uint>(), cold = vec<uint>();
+    for (auto frame_num = 0u; frame_num < data.frame_count; ++frame_num) {
+      if (!movable(frame_num)) continue;
+      if (!data.is_slow(frame_num))
+        cold.push_back(frame_num);
+      else if (heat_of(frame_num) >= promote_heat)
+        hot.push_back(frame_num);
+    }
+    std::ranges::sort(hot, std::greater<>(), heat_of);
+    std::ranges::sort(cold, {}, heat_of);
+
+    auto promoted = 0u;
+    for (auto from : hot) {
+      if (promoted == budget) break;
+
+      auto node = data.node_of_frame(from);
+      auto target = free_fast_frame(node);
+      if (target) migrate_frame(from, *target);
       else {
-        auto [pid, page] = frame_map[i];
-        out << format("[frame {:>2}] → pid={:<3} page={}\n", i, pid, page);
+        // Coldest fast page on the same node, if it is cold enough to trade places
+        auto partner = std::ranges::find_if(cold, [&](uint frame_num) { return data.node_of_frame(frame_num) == node; });
+        if (partner == cold.end() || heat_of(*partner) * 2 >= heat_of(from)) continue;
+        exchange_frames(from, *partner);
+        cold.erase(partner);
+        data.stats.add("tier.demotions");
+        data.stats.add("tier.migrated_bytes", data.page_size);
       }
+      data.stats.add("tier.promotions");
+      data.stats.add("tier.migrated_bytes", data.page_size);
+      ++promoted;
     }
+    return promoted;
+  }
 
+  /**
+   * @brief Renders per-tier occupancy, hit rates and migration bandwidth.
+   * @param ticks Scheduler ticks elapsed, for bytes-per-tick bandwidth.
+   */
+  auto render_tiers(uint ticks) -> str {
+    if (!data.tiered())
+      return "\n[Memory Tiers] single tier (set slow-tier-frames to enable)\n";
+
+    auto used = array<uint,2>{ 0, 0 };
+    for (auto i = 0u; i < data.frame_count; ++i)
+      if (data.frame_table[i]) ++used[data.is_slow(i)];
+
+    auto& stats = data.stats;
+    auto fast = stats.get("tier.fast_hits"), slow = stats.get("tier.slow_hits");
+    auto rate = [&](uint64 hits) { return fast + slow == 0 ? "-"s : format("{:.1f}%", 100.0 * hits / (fast + slow)); };
+    auto bytes = stats.get("tier.migrated_bytes");
+
+    auto out = osstream();
+    out << format("\n[Memory Tiers] slow-cost={} cycles\n", data.slow_cost);
+    out << format("  fast  frames={:<5} used={:<5} hits={:<8} hit-rate={}\n", data.fast_frames, used[0], fast, rate(fast));
+    out << format("  slow  frames={:<5} used={:<5} hits={:<8} hit-rate={}\n", data.frame_count - data.fast_frames, used[1], slow, rate(slow));
+    out << format("  promotions={} demotions={} migrated={} bytes ({:.1f} bytes/tick)\n",
+      stats.get("tier.promotions"), stats.get("tier.demotions"), bytes, ticks == 0 ? 0.0 : cast<double>(bytes) / ticks);
+    return out.str();
+  }
+
+  /** @brief Returns the longest run of consecutive free frames. */
+  auto largest_free_run() -> uint {
+    auto best = 0u, run = 0u;
+    for (auto& owner : data.frame_table) {
+      run = owner ? 0 : run + 1;
+      best = max(best, run);
+    }
+    return best;
+  }
+
+  /**
+   * @brief Renders each NUMA node's frame pool (free and used frames).
+   */
+  auto render_numa() -> str {
+    auto used = vec<uint>(data.numa_nodes, 0u);
+    for (auto i = 0u; i < data.frame_count; ++i)
+      if (data.frame_table[i]) ++used[data.node_of_frame(i)];
+
+    auto out = osstream();
+    out << format("\n[NUMA Nodes] policy={} remote-cost={}\n",
+      data.numa_interleave ? "interleave" : "first-touch", data.numa_remote_cost);
+    for (auto node = 0u; node < data.numa_nodes; ++node)
+      out << format("  node {:<2} free={:<5} used={:<5}\n", node, data.free_frames[node].size(), used[node]);
     return out.str();
   }
 
@@ -122,9 +621,17 @@ class MemoryManager {
       return data.frame_count * data.page_size;
   }
 
+  /** @brief Returns the host memory used by all page tables (directories plus allocated leaves). */
+  auto get_page_table_memory() -> uint {
+    auto total = 0u;
+    for (auto& [_, table] : data.page_table_map)
+      total += table.bytes();
+    return total;
+  }
+
     /** @brief Returns the number of free memory bytes. */
   auto get_free_memory() -> uint {
-    return data.free_frames.size() * data.page_size;
+    return data.free_count() * data.page_size;
   }
 
   /** @brief Returns the number of used memory bytes. */
@@ -138,22 +645,224 @@ class MemoryManager {
   // ------ Internal helpers ------
   private:
 
-  auto alloc(uint pid, uint bytes_needed) -> bool {
+  /** @brief Returns all pids with a page table, in ascending order. */
+  auto sorted_pids() -> vec<uint> {
+    auto pids = vec<uint>();
+    for (auto& [pid, _] : data.page_table_map)
+      pids.push_back(pid);
+    std::ranges::sort(pids);
+    return pids;
+  }
+
+  /**
+   * Declares the address space of a process. Page entries are created lazily by
+   * the radix page table and frames are only assigned on first touch (demand paging).
+   */
+  auto alloc(uint pid, uint bytes_needed, bool huge) -> bool {
     auto pages_needed = (bytes_needed + data.page_size - 1) / data.page_size;
-    auto page_table = PageTable();
+    auto& table = data.page_table_map[pid] = PageTable(pages_needed, huge);
+    table.rss_cap = data.default_rss_cap;
+    return true;
+  }
+
+  /**
+   * Converts a resident-set cap in bytes to frames. Caps are at least two frames,
+   * since a single 2-byte access may straddle a page boundary.
+   */
+  auto rss_frames_for(uint bytes) -> uint {
+    if (bytes == 0 || data.page_size == 0) return 0;
+    return max(2u, bytes / data.page_size);
+  }
+
+  /** Splits all frames into one free pool per NUMA node. */
+  void reset_free_frames() {
+    data.free_frames.assign(data.numa_nodes, deque<uint>());
+    for (auto i = 0u; i < data.frame_count; ++i)
+      data.free_frames[data.node_of_frame(i)].push_back(i);
+  }
+
+  /**
+   * Takes a free frame for a page and records its owner in the reverse map.
+   * The frame comes from the node the NUMA policy prefers, or from the node with
+   * the most free frames if that pool is empty. Requires data.free_count() > 0.
+   */
+  auto take_frame(uint pid, uint page_num) -> uint {
+    auto node = 0u;
+    if (data.numa_interleave)
+      node = page_num % data.numa_nodes;
+    else if (data.node_of)
+      node = min(data.node_of(pid), data.numa_nodes - 1);
+
+    if (data.free_frames[node].empty()) {
+      node = cast<uint>(std::ranges::max_element(data.free_frames, {}, &deque<uint>::size) - data.free_frames.begin());
+      data.stats.add("numa.fallbacks");
+    }
+
+    // Prefer the fast tier; hot pages that land in the slow tier are promoted later
+    auto& pool = data.free_frames[node];
+    auto it = std::ranges::find_if(pool, [&](uint frame_num) { return !data.is_slow(frame_num); });
+    if (it == pool.end()) it = pool.begin();
+    auto frame_num = *it;
+    pool.erase(it);
+    data.frame_table[frame_num] = tup<uint,uint>{ pid, page_num };
+    ++data.page_table_map.at(pid).resident;
+    return frame_num;
+  }
+
+  /**
+   * Returns a frame to its node's free pool and clears its reverse-map entry.
+   * Every unmapping goes through here, so this is where cached translations are invalidated.
+   */
+  void free_frame(uint frame_num) {
+    ++data.epoch;
+
+    auto& owner = data.frame_table[frame_num];
+    if (owner)
+      if (auto it = data.page_table_map.find(get<0>(*owner)); it != data.page_table_map.end())
+        --it->second.resident;
+
+    data.free_frames[data.node_of_frame(frame_num)].push_back(frame_num);
+    owner = nullopt;
+  }
+
+  /** True if the frame holds a resident base page that can be moved to another frame. */
+  auto movable(uint frame_num) -> bool {
+    auto& owner = data.frame_table[frame_num];
+    if (!owner) return false;
+
+    auto [pid, page_num] = *owner;
+    auto it = data.page_table_map.find(pid);
+    if (it == data.page_table_map.end()) return false;
+    auto* page = it->second.find(page_num);
+    return page && page->is_loaded() && !page->huge;
+  }
+
+  /**
+   * Moves the page in frame `from` into the free frame `to`, updating its
+   * PageEntry and the reverse map. Freeing `from` advances the epoch, so
+   * cached translations of the page are dropped.
+   */
+  void migrate_frame(uint from, uint to) {
+    auto [pid, page_num] = *data.frame_table[from];
+    auto& table = data.page_table_map.at(pid);
+    auto& page = table.get(page_num);
+
+    std::copy_n(data.memory.begin() + from * data.page_size, data.page_size,
+                data.memory.begin() + to * data.page_size);
+
+    erase_if(data.free_frames[data.node_of_frame(to)], [&](uint frame_num) { return frame_num == to; });
+    data.frame_table[to] = tup<uint,uint>{ pid, page_num };
+    ++table.resident;  // Balanced by freeing the old frame
+    page.frame_num = to;
+    free_frame(from);
+  }
+
+  /** Returns the page held by an occupied frame. */
+  auto page_in_frame(uint frame_num) -> PageEntry& {
+    auto [pid, page_num] = *data.frame_table[frame_num];
+    return data.page_table_map.at(pid).get(page_num);
+  }
+
+  /** Returns a free fast-tier frame on the given NUMA node, if any. */
+  auto free_fast_frame(uint node) -> opt<uint> {
+    for (auto frame_num : data.free_frames[node])
+      if (!data.is_slow(frame_num)) return frame_num;
+    return nullopt;
+  }
+
+  /** Swaps the contents and owners of two occupied frames. */
+  void exchange_frames(uint a, uint b) {
+    auto& memory = data.memory;
+    std::swap_ranges(memory.begin() + a * data.page_size, memory.begin() + (a + 1) * data.page_size,
+                     memory.begin() + b * data.page_size);
+
+    page_in_frame(a).frame_num = b;
+    page_in_frame(b).frame_num = a;
+    std::swap(data.frame_table[a], data.frame_table[b]);
+    ++data.epoch;  // Both pages moved without going through free_frame()
+  }
+
+  /** Returns the first frame of a free run of `length` frames aligned to `length`, if any. */
+  auto find_free_run(uint length) -> opt<uint> {
+    for (auto start = 0u; start + length <= data.frame_count; start += length) {
+      auto free = true;
+      for (auto i = 0u; free && i < length; ++i)
+        free = !data.frame_table[start + i];
+      if (free) return start;
+    }
+    return nullopt;
+  }
+
+  /** Removes a run found by find_free_run() from the free list (the caller fills in the owners). */
+  void claim_run(uint start) {
+    auto end = start + data.huge_factor;
+    for (auto& pool : data.free_frames)
+      erase_if(pool, [&](uint frame_num) { return frame_num >= start && frame_num < end; });
+  }
+
+  /** True if every page of the region starting at `base` is resident as a base page. */
+  auto region_promotable(PageTable& table, uint base) -> bool {
+    for (auto i = 0u; i < data.huge_factor; ++i) {
+      auto* page = table.find(base + i);
+      if (!page || !page->is_loaded() || page->huge) return false;
+    }
+    return true;
+  }
 
-    for (auto page_num=0; page_num < pages_needed; ++page_num)
-      page_table.add(page_num, PageEntry());
+  /**
+   * Huge fault: maps the whole aligned region around `page_num` onto a free aligned
+   * frame run in one go, so its neighbours never fault individually. Only untouched
+   * regions qualify (no page resident or swapped out); otherwise the caller falls
+   * back to base pages.
+   */
+  auto map_huge_region(uint pid, uint page_num) -> bool {
+    auto factor = data.huge_factor;
+    auto& table = data.page_table_map.at(pid);
+    auto base = page_num / factor * factor;
+    if (factor < 2 || base + factor > table.size())
+      return false;  // Tail of the address space that cannot hold a whole huge page
 
-    data.page_table_map[pid] = move(page_table);
+    for (auto i = 0u; i < factor; ++i) {
+      auto* page = table.find(base + i);
+      if (page && page->has_frame()) return false;
+      if (data.store.contains(BackingStore::make_key(pid, base + i))) return false;
+    }
+
+    if (table.over_cap(factor))
+      return false;  // A whole region would not fit under the resident-set cap
 
-    // Try to preload as many pages as possible (no fault if not all succeed)
-    for (auto page_num = 0u; page_num < pages_needed; ++page_num)
-      page_in(pid, page_num);  // Ignore return value
+    auto run = find_free_run(factor);
+    if (!run) return false;
+    claim_run(*run);
+    table.resident += factor;
 
+    for (auto i = 0u; i < factor; ++i) {
+      auto& page = table.get(base + i);
+      page.frame_num  = *run + i;
+      page.huge       = true;
+      page.dirty      = false;
+      page.prefaulted = base + i != page_num;
+      data.frame_table[*run + i] = tup<uint,uint>{ pid, base + i };
+      data.equeue.push_back({ pid, base + i });
+    }
+    std::fill_n(data.memory.begin() + *run * data.page_size, factor * data.page_size, 0u);
+    data.stats.add("faults");
+    data.stats.add("faults.minor");
+    data.stats.add("huge.faults");
     return true;
   }
 
+  /** Splits the huge page containing `page_num` back into base pages (frames stay where they are). */
+  void demote_huge_region(PageTable& table, uint page_num) {
+    auto base = page_num / data.huge_factor * data.huge_factor;
+    for (auto i = 0u; i < data.huge_factor; ++i) {
+      auto& page = table.get(base + i);
+      page.huge = false;
+      page.prefaulted = false;
+    }
+    data.stats.add("huge.demotions");
+  }
+
   /** Fills the given frame in memory using the provided filler function. */
   void fill_frame(uint frame_num, func<uint(uint)> filler) {
     auto maddr = frame_num * data.page_size;
@@ -164,36 +873,99 @@ class MemoryManager {
   /**
    * Loads the given virtual page into memory for a process.
    * May evict another page if no free frame is available (side effect).
+   *
+   * Pages that were never stored are zero-filled immediately (minor fault).
+   * Stored pages are read asynchronously (major fault): a frame is reserved and
+   * this returns false; the read's completion marks the page resident during a
+   * later poll(), so the faulting instruction simply retries.
    */
   auto page_in(uint pid, uint page_num) -> bool {
-    // Try to get a free frame
-    if (data.free_frames.empty())
-      if (!page_out(pid))
-        return false;   // Couldn't evict a page!
-    
-    // Retrieve free frame
-    auto frame_num = data.free_frames.front();
-    data.free_frames.pop_front();
+    // Land any finished reads first; this page may be one of them
+    poll();
 
-    // Fetch page table and page metadata
     auto& table = data.page_table_map[pid];
     auto& page = table.get(page_num);
+    if (page.is_loaded())  return true;
+    if (page.is_loading()) return false;  // Still waiting on the backing store
+
+    // Huge-page processes map the whole surrounding region when they can
+    if (table.huge && map_huge_region(pid, page_num))
+      return true;
+
+    // At its resident-set cap a process replaces one of its own pages,
+    // so it can't take frames that other processes are faulting on
+    if (table.over_cap()) {
+      if (!page_out(pid))
+        return false;   // Nothing of its own is evictable yet (reads in flight)
+      data.stats.add("evictions.rss_cap");
+    }
+
+    // Try to get a free frame
+    if (data.free_count() == 0)
+      if (!reclaim(pid))
+        return false;   // Couldn't evict a page!
     
-    // Assign physical frame to page
+    data.stats.add("faults");
+    return load(pid, page_num, "faults");
+  }
+
+  /**
+   * Assigns a free frame to a page and fills it: zero-filled if the page was never
+   * swapped out (minor), otherwise read back asynchronously from the store (major).
+   * `kind` prefixes the minor/major counters ("faults" or "prefetch").
+   * Returns true if the page is resident on return.
+   */
+  auto load(uint pid, uint page_num, const str& kind) -> bool {
+    auto& page = data.page_table_map.at(pid).get(page_num);
+
+    // Assign a free physical frame to the page
+    auto start = SteadyClock::now();
+    auto frame_num = take_frame(pid, page_num);
     page.frame_num = frame_num;
-    data.equeue.push_back({ pid, page_num });
+    page.dirty = false;
 
-    // Fill frame with content from backing store or zero-fill
-    auto key = make_key(pid, page_num);
-    if (!data.store.contains(key))
+    // Zero-fill pages that were never swapped out (minor fault)
+    auto key = BackingStore::make_key(pid, page_num);
+    if (!data.store.contains(key)) {
       fill_frame(frame_num, [](uint) -> uint { return 0; });
-    else {
-      auto bytes = move(data.store.at(key));
-      data.store.erase(key);
-      write_store_to_file();  // Reflect changes in text file
-      fill_frame(frame_num, [&](uint i) -> uint { return bytes[i]; });
+      data.equeue.push_back({ pid, page_num });
+      data.stats.add(kind + ".minor");
+      data.stats.histogram("page_in.minor_us").record(elapsed_us(start));
+      return true;
     }
 
+    // Otherwise fetch it from the backing store without blocking the core (major fault)
+    auto tag = data.next_io_tag++;
+    page.io_tag = tag;
+    data.stats.add(kind + ".major");
+    data.store.read(key, [this, pid, page_num, tag, start](vec<uint> bytes) {
+      if (finish_page_in(pid, page_num, tag, bytes))
+        data.stats.histogram("page_in.major_us").record(elapsed_us(start));
+    });
+    return false;
+  }
+
+  /** Returns the microseconds elapsed since `start`. */
+  static auto elapsed_us(SteadyClock::time_point start) -> uint64 {
+    return duration_cast<us>(SteadyClock::now() - start).count();
+  }
+
+  /**
+   * Completion of an asynchronous page-in: fills the reserved frame and marks the page resident.
+   * Returns false if the completion was stale and ignored.
+   */
+  auto finish_page_in(uint pid, uint page_num, uint64 tag, const vec<uint>& bytes) -> bool {
+    auto it = data.page_table_map.find(pid);
+    if (it == data.page_table_map.end())
+      return false;  // Process was released while the read was in flight
+
+    auto* page = it->second.find(page_num);
+    if (page == nullptr || page->io_tag != tag)
+      return false;  // Stale completion (frame was released or reassigned)
+
+    fill_frame(page->frame(), [&](uint i) -> uint { return bytes[i]; });
+    page->io_tag = 0;
+    data.equeue.push_back({ pid, page_num });
     return true;
   }
 
@@ -204,69 +976,123 @@ class MemoryManager {
     */
   auto page_out(uint pid) -> bool {
     for (auto it = data.equeue.begin(); it != data.equeue.end(); ++it) {
-      auto [evict_pid, page_num] = *it;
+      // Evict only pages of this process (self-eviction)
+      if (get<0>(*it) == pid && evictable(*it)) {
+        data.stats.add("evictions.fifo");
+        evict(it);
+        return true;
+      }
+    }
 
-      // Evict only if:
-      // - The page belongs to this process (self-eviction), OR
-      // - The page belongs to a process that is currently preempted or inactive
-      if (!(evict_pid == pid /* || (data.is_preempted && data.is_preempted(evict_pid)) */))
-        continue;
+    // No evictable pages found for this process
+    return false;
+  }
 
-      // Get page table and page entry
-      auto& page_table = data.page_table_map.at(evict_pid);
-      auto& page = page_table.get(page_num);
+  /** Frees one frame for a fault by `pid` when none are free, choosing the victim by the replacement policy. */
+  auto reclaim(uint pid) -> bool {
+    if (!allows_stealing())
+      return page_out(pid);
 
-      if (!page.is_loaded())
-        continue;  // Already unloaded, shouldn't happen but safe to skip
+    auto victim = data.replacement == "hinted" ? hinted_victim(pid) : data.equeue.end();
+    if (victim == data.equeue.end())
+      victim = std::ranges::find_if(data.equeue, [&](auto& entry) { return evictable(entry); });
+    if (victim == data.equeue.end())
+      return false;
 
-      // Get frame number and mark page as unloaded
-      auto frame_num = page.frame();
-      page.frame_num = nullopt;
-      data.free_frames.push_back(frame_num);
+    data.stats.add(data.replacement == "hinted" ? "evictions.hinted" : "evictions.fifo");
+    if (get<0>(*victim) != pid)
+      data.stats.add("evictions.stolen");
+    evict(victim);
+    return true;
+  }
 
-      // Save to backing store
-      auto maddr = frame_num * data.page_size;
-      auto start = data.memory.begin() + maddr;
-      auto end = start + data.page_size;
-      data.store[make_key(pid, page_num)] = vec<uint>(start, end);
-      write_store_to_file();  // Reflect changes in text file
+  /**
+   * Returns the oldest page of the process that will run last according to the
+   * scheduler's hints. Processes running sooner than `pid` are never chosen, so a
+   * fault can't take frames from the process about to be dispatched.
+   */
+  auto hinted_victim(uint pid) -> deque<tup<uint,uint>>::iterator {
+    auto sleepers = umap<uint,uint>();  // Sleeper distances looked up so far (once per pid)
+    auto distance = [&](uint owner) -> uint {
+      if (auto it = data.run_distance.find(owner); it != data.run_distance.end())
+        return it->second;
 
-      // Remove from global queue
-      data.equeue.erase(it);
-      return true;
+      auto [it, added] = sleepers.try_emplace(owner, std::numeric_limits<uint>::max());
+      if (added && data.sleep_left)
+        if (auto left = data.sleep_left(owner))
+          it->second = data.run_behind + *left;
+      return it->second;
+    };
+
+    auto own = distance(pid);
+    auto victim = data.equeue.end();
+    auto furthest = 0u;
+    for (auto it = data.equeue.begin(); it != data.equeue.end(); ++it) {
+      auto owner = get<0>(*it);
+      auto d = distance(owner);
+      if ((owner != pid && d <= own) || !evictable(*it))
+        continue;
+      if (victim == data.equeue.end() || d > furthest) {
+        victim = it;    // Strictly further only, so ties keep the oldest page
+        furthest = d;
+      }
     }
+    return victim;
+  }
 
-    // No evictable pages found for this process
-    return false;
+  /** Evicts a page of a process that runs later than `pid` (hinted replacement only). */
+  auto reclaim_for_prefetch(uint pid) -> bool {
+    if (data.replacement != "hinted")
+      return false;
+
+    auto victim = hinted_victim(pid);
+    if (victim == data.equeue.end() || get<0>(*victim) == pid)
+      return false;  // Never trade one of its own pages for another
+
+    data.stats.add("evictions.hinted");
+    data.stats.add("evictions.stolen");
+    evict(victim);
+    return true;
   }
 
-  /**
-   * Computes a unique 64-bit key for a process-page pair.
-   * Used as the backing store index for evicted pages.
-   */
-  auto make_key(uint pid, uint page_num) -> uint64 {
-    return (cast<uint64>(pid) << 32) | page_num;
+  /** Returns true if the queued page is still resident in a live page table. */
+  auto evictable(const tup<uint,uint>& entry) -> bool {
+    auto it = data.page_table_map.find(get<0>(entry));
+    if (it == data.page_table_map.end()) return false;
+    auto* page = it->second.find(get<1>(entry));
+    return page != nullptr && page->is_loaded();
   }
 
-  /** @brief Writes the entire backing store to 'csopesy-backing-store.txt' as a fresh snapshot. */
-  void write_store_to_file() {
-    auto file = ofstream("csopesy-backing-store.txt", std::ios::trunc);
-    if (!file.is_open()) return;
+  /** Unmaps the queued page, writing it back first if dirty, and removes it from the eviction queue. */
+  void evict(deque<tup<uint,uint>>::iterator it) {
+    auto [evict_pid, page_num] = *it;
+    auto& page_table = data.page_table_map.at(evict_pid);
+    auto& page = page_table.get(page_num);
 
-    file << "[Backing Store Snapshot]\n";
+    // Evicting part of a huge page splits it; the rest stays resident as base pages
+    if (page.huge)
+      demote_huge_region(page_table, page_num);
 
-    for (auto& [key, bytes] : data.store) {
-      uint pid = key >> 32;
-      uint page = key & 0xFFFFFFFF;
+    // Get frame number and mark page as unloaded
+    auto frame_num = page.frame();
+    page.frame_num = nullopt;
+    free_frame(frame_num);
+    data.stats.add("paged_out");
+    data.equeue.erase(it);
 
-      file << format("key={} pid={} page={} [", key, pid, page);
-      for (auto i=0u; i < bytes.size(); ++i) {
-        file << format("{:04x}", bytes[i]);
-        if (i != bytes.size() - 1) file << " ";
-      }
-      file << "]\n";
+    // Clean pages are dropped: the store still holds their copy, or they were
+    // never written and simply zero-fill again on the next fault
+    if (!page.dirty) {
+      data.stats.add("evictions.clean");
+      return;
     }
 
-    file.close();
+    // Queue the write to the backing store (flushed by its I/O workers)
+    auto maddr = frame_num * data.page_size;
+    auto start = data.memory.begin() + maddr;
+    auto end = start + data.page_size;
+    data.store.write(BackingStore::make_key(evict_pid, page_num), vec<uint>(start, end));
+    data.stats.add("writebacks.dirty");
+    page.dirty = false;
   }
 };
@@ -1,5 +1,7 @@
 #pragma once
 #include "core/common/imports/_all.hpp"
+#include "BackingStore.hpp"
+#include "MemoryStats.hpp"
 #include "types.hpp"
 
 
@@ -10,21 +12,80 @@ class MemoryManagerData {
     page_size      (0u),    
     frame_count    (0u),
     memory         (vec<uint>()),
-    free_frames    (deque<uint>()),
+    free_frames    (vec<deque<uint>>()),
+    frame_table    (vec<opt<tup<uint,uint>>>()),
     page_table_map (umap<uint,PageTable>()),
     equeue         (deque<tup<uint, uint>>()),
-    store          (umap<uint64,vec<uint>>()),
+    store          (),
+    stats          (),
+    tier_fast_hits  (stats.counter("tier.fast_hits")),
+    tier_slow_hits  (stats.counter("tier.slow_hits")),
+    numa_local_hits (stats.counter("numa.local")),
+    numa_remote_hits(stats.counter("numa.remote")),
+    next_io_tag    (1u),
+    epoch          (0u),
+    huge_factor    (16u),
+    huge_default   (false),
+    default_rss_cap(0u),
+    numa_nodes     (1u),
+    numa_interleave(false),
+    numa_remote_cost(0u),
+    node_of        (nullptr),
+    fast_frames    (0u),
+    slow_cost      (0u),
+    replacement    ("fifo"s),
+    run_distance   (umap<uint,uint>()),
+    run_behind     (0u),
+    sleep_left     (nullptr),
     is_preempted   (nullptr) {}
 
+  /** @brief Returns the total number of free frames across all NUMA nodes. */
+  auto free_count() -> uint {
+    auto total = 0u;
+    for (auto& pool : free_frames)
+      total += pool.size();
+    return total;
+  }
+
+  /** @brief Returns true if a frame belongs to the slow memory tier. */
+  auto is_slow(uint frame_num) -> bool { return frame_num >= fast_frames; }
+
+  /** @brief Returns true if memory is split into a fast and a slow tier. */
+  auto tiered() -> bool { return fast_frames < frame_count; }
+
+  /** @brief Returns the NUMA node that owns a frame (frames are split into equal contiguous ranges). */
+  auto node_of_frame(uint frame_num) -> uint {
+    return cast<uint64>(frame_num) * numa_nodes / max(1u, frame_count);
+  }
+
   // ------ Member variables ------
   uint page_size;
   uint frame_count;
-  uint num_paged_in  = 0;  ///< Total number of page-ins (page faults resolved)
-  uint num_paged_out = 0;  ///< Total number of evicted pages
   vec<uint> memory;
-  deque<uint> free_frames;
+  vec<deque<uint>> free_frames;   ///< Free frame pool of each NUMA node
+  vec<opt<tup<uint,uint>>> frame_table;  ///< Reverse map: frame → (pid, page_num) of its owner
   umap<uint,PageTable> page_table_map;
   deque<tup<uint, uint>> equeue;
-  umap<uint64,vec<uint>> store;
+  BackingStore store;
+  MemoryStats stats;        ///< Paging counters, gauges and latency histograms
+  Counter& tier_fast_hits;    ///< "tier.fast_hits", resolved once for the per-access path
+  Counter& tier_slow_hits;    ///< "tier.slow_hits", resolved once for the per-access path
+  Counter& numa_local_hits;   ///< "numa.local", resolved once for the per-access path
+  Counter& numa_remote_hits;  ///< "numa.remote", resolved once for the per-access path
+  uint64 next_io_tag;       ///< Tag for the next backing-store read (0 means none)
+  uint64 epoch;             ///< Advances whenever a frame is unmapped, invalidating cached translations
+  uint huge_factor;         ///< Base pages per huge page (huge pages are disabled below 2)
+  bool huge_default;        ///< Whether processes use huge pages unless asked otherwise
+  uint default_rss_cap;     ///< Resident-set cap in frames given to new processes (0 = unlimited)
+  uint numa_nodes;          ///< Number of NUMA nodes the frames are split across
+  bool numa_interleave;     ///< Interleave pages across nodes instead of allocating on first touch
+  uint numa_remote_cost;    ///< Extra cycles charged for each access to another node's memory
+  func<uint(uint)> node_of; ///< Node of the core a pid is running on (first-touch placement)
+  uint fast_frames;         ///< Frames below this index form the fast tier; the rest are the slow tier
+  uint slow_cost;           ///< Extra cycles charged for each access to a slow-tier frame
+  str replacement;          ///< Victim selection when memory is full: fifo, global-fifo or hinted
+  umap<uint,uint> run_distance;  ///< Scheduler hint: dispatches until each running or ready pid runs (0 = running)
+  uint run_behind;               ///< Scheduler hint: distance just past the last ready pid, where sleepers start
+  func<opt<uint>(uint)> sleep_left;  ///< Ticks until a sleeping pid wakes (nullopt if not sleeping), asked lazily
   func<bool(uint)> is_preempted;
 };
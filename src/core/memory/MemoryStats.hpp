@@ -0,0 +1,230 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+
+
+/** @brief A monotonically increasing event count, safe to bump from any thread. */
+class Counter {
+  public:
+
+  Counter():
+    value (0u) {}  // Number of recorded events
+
+  /** @brief Adds `n` events. */
+  void add(uint64 n=1) { value.fetch_add(n, std::memory_order_relaxed); }
+
+  /** @brief Returns the current count. */
+  auto get() const -> uint64 { return value.load(std::memory_order_relaxed); }
+
+  /** @brief Resets the count to zero. */
+  void reset() { value.store(0, std::memory_order_relaxed); }
+
+  // ------ Member variables ------
+  private:
+  atomic<uint64> value;
+};
+
+
+/**
+ * @brief A lock-free histogram with power-of-two buckets.
+ *
+ * Bucket 0 holds zeros and bucket i holds values in [2^(i-1), 2^i), so
+ * percentiles are reported as the upper bound of the bucket they fall in.
+ */
+class Histogram {
+  public:
+  static constexpr uint BUCKETS = 40;
+
+  Histogram():
+    buckets (),    // Per-bucket sample counts
+    count   (0u),  // Total number of samples
+    sum     (0u),  // Sum of all samples
+    peak    (0u) {}  // Largest sample seen
+
+  /** @brief Records one sample. */
+  void record(uint64 value) {
+    auto bucket = min<uint>(std::bit_width(value), BUCKETS - 1);
+    buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+    count.fetch_add(1, std::memory_order_relaxed);
+    sum.fetch_add(value, std::memory_order_relaxed);
+
+    auto seen = peak.load(std::memory_order_relaxed);
+    while (value > seen && !peak.compare_exchange_weak(seen, value, std::memory_order_relaxed)) {}
+  }
+
+  /** @brief Returns an upper bound for the given percentile (0-100) of the recorded samples. */
+  auto percentile(double pct) const -> uint64 {
+    auto total = samples();
+    if (total == 0) return 0;
+
+    auto rank = cast<uint64>(std::ceil(total * pct / 100.0));
+    auto seen = uint64(0);
+    for (auto i = 0u; i < BUCKETS; ++i) {
+      seen += buckets[i].load(std::memory_order_relaxed);
+      if (seen >= max<uint64>(rank, 1))
+        return min(i == 0 ? uint64(0) : (uint64(1) << i) - 1, max_value());
+    }
+    return max_value();
+  }
+
+  /** @brief Returns the number of recorded samples. */
+  auto samples() const -> uint64 { return count.load(std::memory_order_relaxed); }
+
+  /** @brief Returns the sum of recorded samples. */
+  auto total() const -> uint64 { return sum.load(std::memory_order_relaxed); }
+
+  /** @brief Returns the largest recorded sample. */
+  auto max_value() const -> uint64 { return peak.load(std::memory_order_relaxed); }
+
+  /** @brief Clears all samples. */
+  void reset() {
+    for (auto& bucket : buckets) bucket.store(0, std::memory_order_relaxed);
+    count.store(0, std::memory_order_relaxed);
+    sum.store(0, std::memory_order_relaxed);
+    peak.store(0, std::memory_order_relaxed);
+  }
+
+  // ------ Member variables ------
+  private:
+  array<atomic<uint64>, BUCKETS> buckets;
+  atomic<uint64> count;
+  atomic<uint64> sum;
+  atomic<uint64> peak;
+};
+
+
+/**
+ * @brief Registry of the memory system's counters, gauges and histograms.
+ *
+ * Counters and histograms are declared up front, so the registry's maps never
+ * change after construction and updates are plain relaxed atomics (no locks).
+ * Gauges are sampled on demand from callbacks (store size, free frames, ...).
+ *
+ * Names are dotted (`faults.major`); `render()` prints them for people and
+ * `render_json()` emits one JSON object for monitoring scripts.
+ */
+class MemoryStats {
+  public:
+
+  MemoryStats():
+    counters   (ordered_map<str,uptr<Counter>>()),    // name: event counter
+    histograms (ordered_map<str,uptr<Histogram>>()),  // name: sample distribution
+    gauges     (ordered_map<str,func<uint64()>>())    // name: sampled value
+  {
+    for (auto name : {
+      "faults",            // Page-ins started (minor + major)
+      "faults.minor",      // Resolved without I/O (zero-fill)
+      "faults.major",      // Read back from the backing store
+      "paged_in",          // Page-ins seen through to a resident page by an access
+      "paged_out",         // Pages evicted from memory
+      "dispatches",        // Processes assigned to a core
+      "dispatches.backfilled",     // fcfs/rr dispatches that passed a head waiting for memory
+      "dispatches.idle_ready_ms",  // Core-milliseconds fcfs/rr left cores idle while processes were ready
+      "prefetch.pages",    // Working-set pages loaded at dispatch instead of on fault
+      "prefetch.minor",    // Prefetched pages that were zero-filled
+      "prefetch.major",    // Prefetched pages read back from the backing store
+      "prefetch.skipped",  // Working-set pages left out for lack of a free frame or RSS room
+      "swap.outs",         // Sleeping processes swapped out whole
+      "swap.ins",          // Swapped processes brought back before waking
+      "swap.pages_out",    // Pages released by whole-process swap-outs
+      "compaction.passes", // Compaction runs that moved at least one page
+      "compaction.migrations", // Resident pages moved to defragment free frames
+      "tier.fast_hits",    // Accesses served by a fast-tier frame
+      "tier.slow_hits",    // Accesses served by a slow-tier frame (charged extra cycles)
+      "tier.promotions",   // Hot pages moved from the slow tier to the fast tier
+      "tier.demotions",    // Cold pages moved from the fast tier to the slow tier
+      "tier.migrated_bytes", // Bytes copied between tiers
+      "evictions.fifo",    // Evictions chosen by the FIFO policy
+      "evictions.hinted",  // Evictions chosen from the scheduler's run-distance hints
+      "evictions.stolen",  // Evictions that took a frame from another process
+      "evictions.rss_cap", // Evictions forced by a process reaching its resident-set cap
+      "evictions.clean",   // Evicted without I/O (an identical copy already exists)
+      "writebacks.dirty",  // Evictions that wrote a modified page to the store
+      "huge.faults",       // Faults that mapped a whole huge-page region
+      "huge.faults_saved", // First touches of pages a huge fault had already mapped
+      "huge.walks_saved",  // Page changes that stayed inside one huge mapping
+      "huge.promotions",   // Regions collapsed into a huge page
+      "huge.demotions",    // Huge pages split back into base pages
+      "numa.local",        // Accesses to a frame on the accessing core's node
+      "numa.remote",       // Accesses to a frame on another node (charged extra cycles)
+      "numa.fallbacks",    // Frames taken from another node because the preferred pool was empty
+    })
+      counters.emplace(name, make_unique<Counter>());
+
+    for (auto name : {
+      "page_in.minor_us",  // Zero-fill page-in latency
+      "page_in.major_us",  // Fault-to-resident latency of backing-store reads
+    })
+      histograms.emplace(name, make_unique<Histogram>());
+  }
+
+  /** @brief Adds `n` to a counter. */
+  void add(const str& name, uint64 n=1) { counter(name).add(n); }
+
+  /** @brief Returns a registered counter. Throws if the name is unknown. */
+  auto counter(const str& name) -> Counter& { return *counters.at(name); }
+
+  /** @brief Returns the current value of a counter. */
+  auto get(const str& name) -> uint64 { return counter(name).get(); }
+
+  /** @brief Returns a registered histogram. Throws if the name is unknown. */
+  auto histogram(const str& name) -> Histogram& { return *histograms.at(name); }
+
+  /** @brief Registers (or replaces) a gauge sampled by `fn`. */
+  void add_gauge(const str& name, func<uint64()> fn) { gauges[name] = move(fn); }
+
+  /** @brief Zeroes all counters and histograms (gauges are live values). */
+  void reset() {
+    for (auto& [_, counter] : counters) counter->reset();
+    for (auto& [_, histogram] : histograms) histogram->reset();
+  }
+
+  /** @brief Renders every counter, gauge and histogram as aligned text. */
+  auto render() -> str {
+    auto out = osstream();
+    out << "\n[Counters]\n";
+    for (auto& [name, counter] : counters)
+      out << format("  {:<24} {:>10}\n", name, counter->get());
+
+    out << "\n[Gauges]\n";
+    for (auto& [name, gauge] : gauges)
+      out << format("  {:<24} {:>10}\n", name, gauge());
+
+    out << "\n[Histograms]\n";
+    out << format("  {:<24} {:>8} {:>8} {:>8} {:>8} {:>8}\n", "", "count", "p50", "p90", "p99", "max");
+    for (auto& [name, histogram] : histograms)
+      out << format("  {:<24} {:>8} {:>8} {:>8} {:>8} {:>8}\n", name, histogram->samples(),
+        histogram->percentile(50), histogram->percentile(90), histogram->percentile(99), histogram->max_value());
+    return out.str();
+  }
+
+  /**
+   * @brief Renders the registry as a single-line JSON object.
+   * @param extra Additional top-level numeric fields (e.g. memory totals, ticks).
+   */
+  auto render_json(const ordered_map<str,uint64>& extra={}) -> str {
+    auto fields = [](auto& entries, auto value_of) {
+      auto out = ""s;
+      for (auto& [name, entry] : entries)
+        out += format("{}\"{}\":{}", out.empty() ? "" : ",", name, value_of(entry));
+      return out;
+    };
+
+    auto out = "{"s;
+    for (auto& [name, value] : extra)
+      out += format("\"{}\":{},", name, value);
+
+    out += format("\"counters\":{{{}}},", fields(counters, [](auto& c) { return c->get(); }));
+    out += format("\"gauges\":{{{}}},", fields(gauges, [](auto& g) { return g(); }));
+    out += format("\"histograms\":{{{}}}", fields(histograms, [](auto& h) {
+      return format("{{\"count\":{},\"sum\":{},\"p50\":{},\"p90\":{},\"p99\":{},\"max\":{}}}",
+        h->samples(), h->total(), h->percentile(50), h->percentile(90), h->percentile(99), h->max_value());
+    }));
+    return out + "}";
+  }
+
+  // ------ Member variables ------
+  private:
+  ordered_map<str,uptr<Counter>> counters;
+  ordered_map<str,uptr<Histogram>> histograms;
+  ordered_map<str,func<uint64()>> gauges;
+};
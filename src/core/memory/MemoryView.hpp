@@ -8,9 +8,15 @@ class MemoryView {
   public:
 
   MemoryView(uint pid, MemoryManagerData& data, func<bool(uint, uint)> page_in):
-    pid     (pid),        // Process ID owning this memory view
-    data    (data),       // Reference to shared memory manager state (frames, tables, store, etc.)
-    page_in (page_in) {}  // Page-in callback: loads (pid, page_num) into memory if not present
+    pid       (pid),        // Process ID owning this memory view
+    data      (data),       // Reference to shared memory manager state (frames, tables, store, etc.)
+    page_in   (page_in),    // Page-in callback: loads (pid, page_num) into memory if not present
+    last_page (nullopt),    // Page of the previous translation (models a one-entry TLB)
+    pending   (nullopt),    // Progress of a range operation interrupted by a page fault
+    node        (0u),       // NUMA node of the core this process was last dispatched to
+    numa_local  (0u),       // Accesses to frames on the node of the core running this process
+    numa_remote (0u),       // Accesses to frames on other nodes
+    stall_cycles(0u) {}     // Remote-access cycles still owed (paid off by Process::step)
 
   /**
    * @brief Reads a 2-byte value from virtual memory.
@@ -23,13 +29,13 @@ class MemoryView {
     if (!has_pages_for(vaddr, 2))
       return {0, true, false}; // access violation
 
-    auto m1 = maddr_of(vaddr);      
-    auto m2 = maddr_of(vaddr + 1);
-    if (!m1 || !m2)
+    auto maddrs = word_maddrs_of(vaddr);
+    if (!maddrs)
       return {0, false, true}; // page fault
 
-    auto lower_byte = data.memory[*m1];
-    auto upper_byte = data.memory[*m2] << 8;
+    auto [m1, m2] = *maddrs;
+    auto lower_byte = data.memory[m1];
+    auto upper_byte = data.memory[m2] << 8;
     return {lower_byte | upper_byte, false, false};
   }
     
@@ -43,20 +49,167 @@ class MemoryView {
     if (!has_pages_for(vaddr, 2))
       return {true, false}; // access violation
 
-    auto m1 = maddr_of(vaddr);
-    auto m2 = maddr_of(vaddr+1);
-    if (!m1 || !m2)
+    auto maddrs = word_maddrs_of(vaddr);
+    if (!maddrs)
       return {false, true}; // page fault
 
-    data.memory[*m1] = value & 0xFF;
-    data.memory[*m2] = (value >> 8) & 0xFF;
+    auto [m1, m2] = *maddrs;
+    data.memory[m1] = value & 0xFF;
+    data.memory[m2] = (value >> 8) & 0xFF;
+    mark_dirty(vaddr, 2);
+    return {false, false};
+  }
+
+  /**
+   * @brief Reads `len` bytes starting at `vaddr` into `out`.
+   * @return (is_violation, is_page_fault)
+   */
+  auto read_range(uint vaddr, uint len, vec<uint>& out) -> tup<bool, bool> {
+    if (!has_pages_for(vaddr, len))
+      return {true, false};
+
+    auto& op = resume('R', vaddr, 0, len);
+    auto& buffer = op.buffers[0];
+    buffer.resize(len);
+    if (!stream(vaddr, len, op.passes[0], [&](uint maddr, uint size, uint done) {
+      std::copy_n(data.memory.begin() + maddr, size, buffer.begin() + done);
+    }))
+      return {false, true};
+
+    out = move(buffer);
+    pending = nullopt;
+    return {false, false};
+  }
+
+  /**
+   * @brief Writes `bytes` starting at `vaddr`.
+   * @return (is_violation, is_page_fault)
+   */
+  auto write_range(uint vaddr, const vec<uint>& bytes) -> tup<bool, bool> {
+    auto len = cast<uint>(bytes.size());
+    if (!has_pages_for(vaddr, len))
+      return {true, false};
+
+    auto& op = resume('W', vaddr, 0, len);
+    if (!stream(vaddr, len, op.passes[0], [&](uint maddr, uint size, uint done) {
+      std::copy_n(bytes.begin() + done, size, data.memory.begin() + maddr);
+    }, true))
+      return {false, true};
+
+    pending = nullopt;
     return {false, false};
   }
 
+  /**
+   * @brief Sets `len` bytes starting at `vaddr` to the low byte of `value`.
+   * @return (is_violation, is_page_fault)
+   */
+  auto fill_range(uint vaddr, uint value, uint len) -> tup<bool, bool> {
+    if (!has_pages_for(vaddr, len))
+      return {true, false};
+
+    auto& op = resume('S', vaddr, value, len);
+    if (!stream(vaddr, len, op.passes[0], [&](uint maddr, uint size, uint) {
+      std::fill_n(data.memory.begin() + maddr, size, value & 0xFF);
+    }, true))
+      return {false, true};
+
+    pending = nullopt;
+    return {false, false};
+  }
+
+  /**
+   * @brief Copies `len` bytes from `src` to `dst` (overlapping ranges behave like memmove).
+   * @return (is_violation, is_page_fault)
+   */
+  auto copy_range(uint dst, uint src, uint len) -> tup<bool, bool> {
+    if (!has_pages_for(src, len) || !has_pages_for(dst, len))
+      return {true, false};
+
+    // Staging the whole source first keeps overlapping copies correct
+    auto& op = resume('C', dst, src, len);
+    auto& buffer = op.buffers[0];
+    buffer.resize(len);
+
+    if (!stream(src, len, op.passes[0], [&](uint maddr, uint size, uint done) {
+      std::copy_n(data.memory.begin() + maddr, size, buffer.begin() + done);
+    }))
+      return {false, true};
+
+    if (!stream(dst, len, op.passes[1], [&](uint maddr, uint size, uint done) {
+      std::copy_n(buffer.begin() + done, size, data.memory.begin() + maddr);
+    }, true))
+      return {false, true};
+
+    pending = nullopt;
+    return {false, false};
+  }
+
+  /**
+   * @brief Compares `len` bytes at `lhs` and `rhs` like memcmp.
+   * @return (order, is_violation, is_page_fault) where order is <0, 0 or >0
+   */
+  auto compare_range(uint lhs, uint rhs, uint len) -> tup<int, bool, bool> {
+    if (!has_pages_for(lhs, len) || !has_pages_for(rhs, len))
+      return {0, true, false};
+
+    auto& op = resume('M', lhs, rhs, len);
+    auto& [left, right] = op.buffers;
+    left.resize(len);
+    right.resize(len);
+
+    if (!stream(lhs, len, op.passes[0], [&](uint maddr, uint size, uint done) {
+      std::copy_n(data.memory.begin() + maddr, size, left.begin() + done);
+    }))
+      return {0, false, true};
+
+    if (!stream(rhs, len, op.passes[1], [&](uint maddr, uint size, uint done) {
+      std::copy_n(data.memory.begin() + maddr, size, right.begin() + done);
+    }))
+      return {0, false, true};
+
+    auto [it, other] = std::ranges::mismatch(left, right);
+    auto order = it == left.end() ? 0 : (*it < *other ? -1 : 1);
+    pending = nullopt;
+    return {order, false, false};
+  }
+
+  /**
+   * @brief Returns the translation of a resident range that lies within one page, without faulting.
+   * @return nullopt if the range straddles a page or its page is not resident.
+   */
+  auto lookup(uint vaddr, uint num_bytes) -> opt<Translation> {
+    auto page_num = vaddr / data.page_size;
+    if ((vaddr + num_bytes - 1) / data.page_size != page_num)
+      return nullopt;
+
+    auto it = data.page_table_map.find(pid);
+    if (it == data.page_table_map.end())
+      return nullopt;
+
+    auto* page = it->second.find(page_num);
+    if (page == nullptr || !page->is_loaded())
+      return nullopt;
+
+    return Translation{ page->frame() * data.page_size + vaddr % data.page_size, page_num, page, data.epoch };
+  }
+
+  /** @brief Returns true if no frame has been unmapped since the translation was resolved. */
+  auto is_current(const Translation& translation) -> bool { return translation.epoch == data.epoch; }
+
+  /** @brief Records an access made through a cached translation (heat, NUMA, huge-page savings). */
+  void touch(Translation& translation) { touch(*translation.page, translation.page_num); }
+
   // ------ Member variables ------
   uint pid;
   MemoryManagerData& data;
   func<bool(uint,uint)> page_in;
+  opt<uint> last_page;
+  opt<RangeOp> pending;
+  uint node;
+  uint64 numa_local;
+  uint64 numa_remote;
+  uint stall_cycles;
   
   // ------ Internal Helpers ------
   private:
@@ -67,14 +220,10 @@ class MemoryView {
     if (it == data.page_table_map.end())
       return false;
     
+    // Declared pages are contiguous from 0, so only the last page needs checking
     auto& page_table = it->second;
-    auto start = vaddr / data.page_size;
     auto end = (vaddr + num_bytes - 1) / data.page_size;
-
-    for (auto page_num=start; page_num <= end; ++page_num)
-      if (!page_table.has_page(page_num))
-        return false;
-    return true;
+    return page_table.has_page(end);
   }
 
   /**
@@ -105,9 +254,102 @@ class MemoryView {
       if (!success) return nullopt;
 
       // if now loaded after success, count it
-      if (page.is_loaded()) ++data.num_paged_in;
+      if (page.is_loaded()) data.stats.add("paged_in");
     }
 
+    touch(page, page_num);
     return page.frame() * data.page_size + offset;
   }
+
+  /**
+   * @brief Translates both bytes of a 2-byte access at `vaddr`.
+   * A word within one page is translated (and touched) once; only a word that
+   * straddles a page boundary translates each page.
+   */
+  auto word_maddrs_of(uint vaddr) -> opt<tup<uint,uint>> {
+    auto m1 = maddr_of(vaddr);
+    if (!m1) return nullopt;
+    if ((vaddr + 1) % data.page_size != 0)
+      return tup<uint,uint>{ *m1, *m1 + 1 };
+
+    auto m2 = maddr_of(vaddr + 1);
+    if (!m2) return nullopt;
+    return tup<uint,uint>{ *m1, *m2 };
+  }
+
+  /** @brief Returns the interrupted range operation with this key, or starts a new one. */
+  auto resume(char kind, uint lhs, uint rhs, uint len) -> RangeOp& {
+    auto key = tup<char,uint,uint,uint>{ kind, lhs, rhs, len };
+    if (!pending || pending->key != key)
+      pending.emplace(kind, lhs, rhs, len);
+    return *pending;
+  }
+
+  /**
+   * @brief Walks a range one page at a time, from `done` bytes in, translating each page once.
+   *
+   * `fn(maddr, size, done)` receives each page-bounded chunk of physical memory and
+   * the range offset it starts at. Only one page has to be resident at a time, and
+   * `done` is advanced as chunks finish so a page fault can be resumed from there.
+   * Pass `writes` when `fn` modifies memory so the pages are marked dirty.
+   *
+   * @return False if a page fault stopped the walk.
+   */
+  auto stream(uint vaddr, uint len, uint& done, func<void(uint,uint,uint)> fn, bool writes=false) -> bool {
+    while (done < len) {
+      auto maddr = maddr_of(vaddr + done);
+      if (!maddr) return false;
+
+      auto size = min(data.page_size - (vaddr + done) % data.page_size, len - done);
+      fn(*maddr, size, done);
+      if (writes) mark_dirty(vaddr + done, size);
+      done += size;
+    }
+    return true;
+  }
+
+  /** @brief Marks every page overlapping [vaddr, vaddr + len) as modified. */
+  void mark_dirty(uint vaddr, uint len) {
+    auto& page_table = data.page_table_map.at(pid);
+    for (auto page_num = vaddr / data.page_size; page_num <= (vaddr + len - 1) / data.page_size; ++page_num)
+      page_table.get(page_num).dirty = true;
+  }
+
+  /** @brief Records an access to a resident page (heat and huge-page savings). */
+  void touch(PageEntry& page, uint page_num) {
+    // Huge-page savings: a neighbour's fault already mapped this page, and moving
+    // between pages of one huge mapping needs no new translation
+    if (page.prefaulted) {
+      page.prefaulted = false;
+      data.stats.add("huge.faults_saved");
+    }
+    if (page.huge && last_page && *last_page != page_num
+        && *last_page / data.huge_factor == page_num / data.huge_factor)
+      data.stats.add("huge.walks_saved");
+    last_page = page_num;
+
+    ++page.heat;  // Access counter for the heatmap (decayed by MemoryManager)
+    page.referenced = true;  // Part of the working set prefetched at the next dispatch
+
+    // Tiers: an access to a slow-tier frame is charged extra cycles
+    if (data.tiered()) {
+      if (data.is_slow(page.frame())) {
+        stall_cycles += data.slow_cost;
+        data.tier_slow_hits.add();
+      } else
+        data.tier_fast_hits.add();
+    }
+
+    // NUMA: an access to another node's frame is charged extra cycles
+    if (data.numa_nodes > 1) {
+      if (data.node_of_frame(page.frame()) == node) {
+        ++numa_local;
+        data.numa_local_hits.add();
+      } else {
+        ++numa_remote;
+        stall_cycles += data.numa_remote_cost;
+        data.numa_remote_hits.add();
+      }
+    }
+  }
 };
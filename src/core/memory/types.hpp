@@ -7,48 +7,161 @@ class PageEntry {
   public:
 
   PageEntry():
-  frame_num (nullopt) {} // The physical frame index (nullopt if not loaded)
+    frame_num (nullopt),  // The physical frame index (nullopt if not loaded)
+    io_tag    (0u),       // Non-zero while a backing-store read into the frame is in flight
+    heat      (0u),       // Recent access count (halved periodically by the memory manager)
+    huge      (false),    // True while the page is part of a huge-page mapping
+    dirty     (false),    // True if written since it was loaded (eviction must write it back)
+    prefaulted(false),    // True if mapped by a huge fault on a neighbour and not yet touched
+    referenced(false) {}  // True if accessed since the owner was last dispatched
   
   /** @brief Returns true if this page is loaded in a physical frame. */
-  auto is_loaded() -> bool { return frame_num.has_value(); }
+  auto is_loaded() -> bool { return frame_num.has_value() && io_tag == 0; }
+
+  /** @brief Returns true if a frame is reserved but still waiting on the backing store. */
+  auto is_loading() -> bool { return io_tag != 0; }
+
+  /** @brief Returns true if this page holds a physical frame (loaded or loading). */
+  auto has_frame() -> bool { return frame_num.has_value(); }
   
   /** @brief Returns the physical frame number. Throws if not loaded. */
   auto frame() -> uint { return frame_num.value(); }
   
   // ------ Member variables ------
   opt<uint> frame_num;
+  uint64 io_tag;
+  uint heat;
+  bool huge;
+  bool dirty;
+  bool prefaulted;
+  bool referenced;
 };
 
 
 /**
- * @brief Represents the page table for a process.
- * Maps virtual page numbers to their PageEntry metadata.
+ * @brief Represents the page table for a process as a two-level radix tree.
+ *
+ * A virtual page number is split into a directory index (upper bits) and a
+ * leaf index (lower `LEAF_BITS` bits). Leaves of `LEAF_SIZE` entries are only
+ * allocated the first time one of their pages is touched, so a process can
+ * declare a large address space and only pay for the regions it uses.
  */
 class PageTable {
   public:
+  static constexpr uint LEAF_BITS = 6;
+  static constexpr uint LEAF_SIZE = 1u << LEAF_BITS;
+  using Leaf = array<PageEntry, LEAF_SIZE>;
+
+  PageTable(uint page_count=0, bool huge=false):
+    page_count (page_count),                        // Number of declared virtual pages
+    leaf_count (0u),                                // Number of leaves allocated so far
+    huge       (huge),                              // Whether faults may map whole huge-page regions
+    resident   (0u),                                // Frames currently held (loaded or loading)
+    rss_cap    (0u),                                // Resident-set limit in frames (0 = unlimited)
+    working_set(vec<uint>()),                       // Pages referenced during the last time slice
+    swapped    (false),                             // True while the swapper holds its resident set in the store
+    directory  (vec<uptr<Leaf>>(dir_size_for(page_count))) {}  // Directory slot: leaf (null until touched)
+
+  /** @brief Returns true if this table declares the given virtual page. */
+  auto has_page(uint page_num) -> bool { return page_num < page_count; }
 
-  PageTable(): 
-    entries (umap<uint,PageEntry>()) {}  // Virtual page number: metadata
+  /** @brief Returns the number of declared virtual pages. */
+  auto size() -> uint { return page_count; }
 
-  /** @brief Returns true if this table tracks the given virtual page. */
-  auto has_page(uint page_num) -> bool { return entries.contains(page_num); }
+  /** @brief Returns true if taking `frames` more frames would exceed the resident-set cap. */
+  auto over_cap(uint frames=1) -> bool { return rss_cap > 0 && resident + frames > rss_cap; }
 
-  /** @brief Returns a reference to the PageEntry for the given page. */
-  auto get(int page_num) -> PageEntry& { return entries.at(page_num); }
+  /** @brief Returns a reference to the PageEntry for the given page, allocating its leaf if needed. */
+  auto get(uint page_num) -> PageEntry& {
+    if (!has_page(page_num))
+      throw out_of_range(format("PageTable::get: page {} is not declared", page_num));
 
-  /** @brief Adds a PageEntry to the table for the given page number. */
-  void add(uint page_num, PageEntry page) { entries[page_num] = page; }
+    auto& leaf = directory[page_num >> LEAF_BITS];
+    if (!leaf) {
+      leaf = make_unique<Leaf>();
+      ++leaf_count;
+    }
+    return (*leaf)[page_num & (LEAF_SIZE - 1)];
+  }
+
+  /** @brief Returns the PageEntry for the given page, or nullptr if its leaf was never touched. */
+  auto find(uint page_num) -> PageEntry* {
+    if (!has_page(page_num)) return nullptr;
+    auto& leaf = directory[page_num >> LEAF_BITS];
+    return leaf ? &(*leaf)[page_num & (LEAF_SIZE - 1)] : nullptr;
+  }
 
-  /** @brief Returns a view of all stored virtual page numbers. */
+  /** @brief Returns the virtual page numbers covered by allocated leaves. */
   auto pages() -> vec<uint> {
     auto keys = vec<uint>();
-    keys.reserve(entries.size());
+    keys.reserve(leaf_count * LEAF_SIZE);
 
-    for (auto& [key, _]: entries)
-      keys.push_back(key);
+    for (auto dir = 0u; dir < directory.size(); ++dir) {
+      if (!directory[dir]) continue;
+      auto base = dir << LEAF_BITS;
+      for (auto i = 0u; i < LEAF_SIZE && base + i < page_count; ++i)
+        keys.push_back(base + i);
+    }
     return keys;
   }
 
+  /** @brief Returns the host memory used by this table (directory plus allocated leaves). */
+  auto bytes() -> uint {
+    return directory.size() * sizeof(uptr<Leaf>) + leaf_count * sizeof(Leaf);
+  }
+
+  // ------ Member variables ------
+  uint page_count;
+  uint leaf_count;
+  bool huge;
+  uint resident;
+  uint rss_cap;
+  vec<uint> working_set;
+  bool swapped;
+  vec<uptr<Leaf>> directory;
+
+  // ------ Internal helpers ------
+  private:
+
+  /** @brief Returns the number of directory slots needed to cover the given page count. */
+  static auto dir_size_for(uint page_count) -> uint {
+    return (page_count + LEAF_SIZE - 1) / LEAF_SIZE;
+  }
+};
+
+
+/**
+ * @brief Progress of a bulk range operation that stopped on a page fault.
+ *
+ * Range operations stream one page at a time, so a range wider than the
+ * frames available still completes: when the faulting instruction retries with
+ * the same operands it resumes from here instead of starting over.
+ */
+class RangeOp {
+  public:
+
+  RangeOp(char kind, uint lhs, uint rhs, uint len):
+    key    ({ kind, lhs, rhs, len }),  // Operation and operands this progress belongs to
+    passes ({ 0u, 0u }),               // Bytes finished by each of the (at most two) passes
+    buffers({ vec<uint>(), vec<uint>() }) {}  // Staging buffers for gathered bytes
+
   // ------ Member variables ------
-  umap<uint,PageEntry> entries;
+  tup<char,uint,uint,uint> key;
+  array<uint,2> passes;
+  array<vec<uint>,2> buffers;
+};
+
+
+/**
+ * @brief A resolved virtual-to-physical translation within one resident page.
+ *
+ * Only valid while MemoryManagerData::epoch is unchanged: the epoch advances
+ * whenever a frame is unmapped (eviction, release, migration), so a matching
+ * epoch proves the page still sits in the same frame.
+ */
+struct Translation {
+  uint maddr;        // Physical address of the first byte
+  uint page_num;     // Virtual page containing it
+  PageEntry* page;   // Its page entry (radix leaves never move while the table lives)
+  uint64 epoch;      // Epoch the translation was resolved in
 };
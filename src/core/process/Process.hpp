@@ -33,14 +33,34 @@ class Process {
       )
     ) {}
 
+  /**
+   * @brief Finishes the SLEEP the process is blocked on and moves past it.
+   *
+   * Used when its wake tick comes up, instead of stepping it through every
+   * tick of the sleep. The wake tick already counts any remote-access stall
+   * it owed, so that is cleared too.
+   */
+  void wake() {
+    data.control.wake();
+    data.memory.virtual_memory.stall_cycles = 0;
+    data.program.ip++;
+  }
+
   /** @brief Executes a single instruction step for the given process. */
   auto step() -> bool {
     auto& program = data.program;
     if (program.finished())
       return true;          
       
+    // Pay off cycles charged for remote NUMA accesses before executing further
+    auto& view = data.memory.virtual_memory;
+    if (view.stall_cycles > 0) {
+      --view.stall_cycles;
+      return false;
+    }
+
     auto ip = program.ip; 
-    auto& inst = data.program.script.at(ip);
+    auto& inst = program.fetch(ip);
     interpreter.execute(inst, data);
 
     // Don't auto-advance ip if it was not manually set
@@ -23,7 +23,10 @@ class ProcessControl {
   
   /** @brief Advances sleep state by one tick, if sleeping. */
   void tick() { if (sleep_ticks > 0) --sleep_ticks; }
+
+  /** @brief Ends the sleep at once. */
+  void wake() { sleep_ticks = 0; }
   
   // ------ Instance variables ------
-  uint sleep_ticks;
+  uint sleep_ticks;   // Ticks left; off-core sleepers keep their count from release and wait in the scheduler's timer wheel
 };
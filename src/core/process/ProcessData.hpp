@@ -25,6 +25,10 @@ class ProcessData {
     logs    (vec<str>()),                 // Output logs collected from PRINT instructions
     core_id (0u),                         // ID of the core this process is assigned to (0 if unassigned)
     stime   (Clock::now()),               // Timestamp of when the process was created
+    ftime   (nullopt),                    // Timestamp of when the process finished (if it has)
+    weight  (1u),                         // CPU share under lottery/stride scheduling (tickets)
+    nice    (0),                          // CFS priority, -20 (most CPU) to 19 (least)
+    rt      (RealTime()),                 // Deadline and period under EDF scheduling
     memory  (ProcessMemory(move(view))),  // TODO: docs
     program (ProcessProgram(script)),     // List of instructions and execution context
     control (ProcessControl()) {}         // Sleep controller of the process
@@ -38,6 +42,10 @@ class ProcessData {
   vec<str> logs;         
   uint core_id;       
   Time stime;        
+  opt<Time> ftime;
+  uint weight;
+  int nice;
+  RealTime rt;
   ProcessMemory memory;   
   ProcessProgram program; 
   ProcessControl control; 
@@ -14,6 +14,11 @@
  * It simulates a symbol table of up to 32 variables (64 bytes total),
  * where each variable takes up 2 bytes (16-bit values).
  * 
+ * Each symbol caches its resolved (frame, offset) translation. A cached
+ * access skips the page-table walk and goes straight to physical memory;
+ * the cache is dropped as soon as the memory manager's epoch shows that
+ * some frame was unmapped since it was resolved.
+ *
  * @note Use `set()` and `get()` to safely write and read memory.
  *       Use `resolve()` to decode literals or variables.
  */
@@ -22,10 +27,13 @@ class ProcessMemory {
 
   /** Constructs a process memory system with a backing memory view. */
   ProcessMemory(MemoryView view):
-    symbol_table(umap<str,uint>()), // Maps variable names to virtual addresses
+    symbol_table(umap<str,Symbol>()), // Maps variable names to virtual addresses (and cached translations)
     virtual_memory (view),          // Reference to the process's virtual memory (MemoryView)
     next_addr      (0u),            // Next available address for a new variable (2-byte aligned)
-    symbol_limit   (32u) {}         // Maximum number of variables allowed (2 bytes each)
+    symbol_limit   (32u),           // Maximum number of variables allowed (2 bytes each)
+    cache_enabled  (true),          // Whether symbol accesses may use cached translations
+    cache_hits     (0u),            // Accesses served from a cached translation
+    cache_misses   (0u) {}          // Accesses that walked the page table
 
   /**
    * @brief Writes a 2-byte (16-bit) value to a declared or new variable.
@@ -41,17 +49,23 @@ class ProcessMemory {
    *         - is_symbol_limit (bool): true if variable couldn't be declared (table full)
    */
   auto set(const str& var, uint value) -> tup<bool, bool, bool> {
-    if (symbol_table.contains(var)) {
-      auto addr = symbol_table[var];
-      auto [is_violation, is_page_fault] = virtual_memory.write(addr, value);
-      return {is_violation, is_page_fault, false};
+    auto it = symbol_table.find(var);
+    if (it == symbol_table.end() && symbol_table.size() < symbol_limit) {
+      it = symbol_table.emplace(var, Symbol{ next_addr, nullopt }).first;
+      next_addr += 2;
     }
 
-    if (symbol_table.size() < symbol_limit) {
-      auto addr = next_addr;
-      symbol_table[var] = addr;
-      next_addr += 2;
-      auto [is_violation, is_page_fault] = virtual_memory.write(addr, value);
+    if (it != symbol_table.end()) {
+      auto& symbol = it->second;
+      if (auto* translation = cached(symbol)) {
+        virtual_memory.data.memory[translation->maddr]     = value & 0xFF;
+        virtual_memory.data.memory[translation->maddr + 1] = (value >> 8) & 0xFF;
+        translation->page->dirty = true;
+        return {false, false, false};
+      }
+
+      auto [is_violation, is_page_fault] = virtual_memory.write(symbol.vaddr, value);
+      if (!is_violation && !is_page_fault) refresh(symbol);
       return {is_violation, is_page_fault, false};
     }
 
@@ -70,11 +84,18 @@ class ProcessMemory {
    *         - is_undeclared (bool): true if variable is undeclared
    */
   auto get(const str& var) -> tup<uint,bool,bool,bool> {
-    if (!symbol_table.contains(var))
+    auto it = symbol_table.find(var);
+    if (it == symbol_table.end())
       return {0, true, false, true}; // undeclared = true
 
-    auto addr = symbol_table[var];
-    auto [value, is_violation, is_page_fault] = virtual_memory.read(addr);
+    auto& symbol = it->second;
+    if (auto* translation = cached(symbol)) {
+      auto& memory = virtual_memory.data.memory;
+      return {memory[translation->maddr] | (memory[translation->maddr + 1] << 8), false, false, false};
+    }
+
+    auto [value, is_violation, is_page_fault] = virtual_memory.read(symbol.vaddr);
+    if (!is_violation && !is_page_fault) refresh(symbol);
     return {value, is_violation, is_page_fault, false}; // undeclared = false
   }
 
@@ -91,6 +112,10 @@ class ProcessMemory {
    *         - page_fault (bool): true if page fault occurred
    */
   auto resolve(const str& token) -> tup<uint, bool, bool, bool> {
+    // Variable names never start with a digit; skip the (throwing) numeric parse for them
+    if (!token.empty() && !isdigit(cast<uchar>(token[0])))
+      return get(token);
+
     // Try to parse it as a number (supports hex, clamps overflow)
     auto value =  stoui(token);
     if (value != 0 || token == "0")  // catch both "0" and valid numbers
@@ -106,9 +131,9 @@ class ProcessMemory {
       return "  <empty>\n";
     
     auto out = osstream();
-    for (auto& [var, vaddr] : symbol_table) {
-      auto [value, violation, fault] = virtual_memory.read(vaddr);
-      out << format("  {:<6} → vaddr={:#06x} = {:<5}", var, vaddr, value);
+    for (auto& [var, symbol] : symbol_table) {
+      auto [value, violation, fault] = virtual_memory.read(symbol.vaddr);
+      out << format("  {:<6} → vaddr={:#06x} = {:<5}", var, symbol.vaddr, value);
       if (violation) out << "  [VIOLATION]";
       if (fault)     out << "  [PAGE FAULT]";
       out << '\n';
@@ -117,8 +142,34 @@ class ProcessMemory {
   }
 
   // ------ Member variables ------
-  umap<str,uint> symbol_table;
+  umap<str,Symbol> symbol_table;
   MemoryView virtual_memory;
   uint next_addr;  
   uint symbol_limit;
+  bool cache_enabled;
+  uint64 cache_hits;
+  uint64 cache_misses;
+
+  private:
+
+  /**
+   * @brief Returns the symbol's translation if it is still valid, recording the access.
+   * @return nullptr on a miss (no translation, stale epoch, or caching disabled).
+   */
+  auto cached(Symbol& symbol) -> Translation* {
+    if (cache_enabled && symbol.cache && virtual_memory.is_current(*symbol.cache)) {
+      ++cache_hits;
+      virtual_memory.touch(*symbol.cache);
+      return &*symbol.cache;
+    }
+    ++cache_misses;
+    symbol.cache = nullopt;
+    return nullptr;
+  }
+
+  /** @brief Re-resolves the symbol's translation after a successful walk. */
+  void refresh(Symbol& symbol) {
+    if (cache_enabled)
+      symbol.cache = virtual_memory.lookup(symbol.vaddr, 2);
+  }
 };
@@ -1,30 +1,41 @@
 #pragma once
 #include "core/instruction/Instruction.hpp"
+#include "ProgramCode.hpp"
 #include "types.hpp"
 
   
 /**
  * @brief A program that can be executed by a process.
  * 
- * Contains a flat list of instructions, an instruction pointer,
- * and a control context stack (used by FOR loops).
+ * Contains the encoded instructions (decoded a region at a time, see
+ * ProgramCode), an instruction pointer, and a control context stack
+ * (used by FOR loops).
  */
 class ProcessProgram {
   public:
 
   /** @brief Loads an instruction script. */
   ProcessProgram(vec<Instruction> script): 
-    script        (vec<Instruction>(move(script))), // Flat list of all program instructions
+    code          (ProgramCode(script)),            // Encoded program instructions
     context       (ContextStack()),                 // Stack of active loop contexts
     is_terminated (false),                          // For terminating process
     ip_was_set    (false),                          // For blocking instruction pointer advancing
     ip            (0) {}                            // Current instruction pointer
 
   /** @brief Returns the size of the script. */
-  auto size() -> uint { return script.size(); }
+  auto size() -> uint { return code.size(); }
   
   /** @brief Check if the program has completed execution. */
-  auto finished() -> bool { return ip >= script.size() || is_terminated; }
+  auto finished() -> bool { return ip >= code.size() || is_terminated; }
+
+  /** @brief Returns the instruction at `addr`, paging its code region in if needed. */
+  auto fetch(uint addr) -> Instruction& { return code.at(addr); }
+
+  /** @brief Returns the opcode at `addr` without paging its code region in. */
+  auto opcode_at(uint addr) -> const str& { return code.opcode_at(addr); }
+
+  /** @brief Caches the exit address of the control-flow instruction at `addr`. */
+  void set_exit(uint addr, uint exit) { code.set_exit(addr, exit); }
   
   /** @brief Terminate a program prematurely. */
   void terminate() { is_terminated = true; }
@@ -38,11 +49,11 @@ class ProcessProgram {
   /** @brief Returns a formatted view of all instructions with the current IP highlighted. */
   auto render_script() -> str {
     // Compute the width needed to align inst indices
-    auto width = count_digits(script.size()-1);
+    auto width = count_digits(code.size()-1);
     auto out = osstream();
     
     // Render each instruction line, marking the current IP with a '>'
-    for (auto i=0u; i < script.size(); ++i)
+    for (auto i=0u; i < code.size(); ++i)
       out << render_line(i, width);
     return out.str();
   }
@@ -54,7 +65,7 @@ class ProcessProgram {
       return "  <empty>\n";  
     
     // Compute width for formatting inst indices
-    uint width = count_digits(script.size()-1); 
+    uint width = count_digits(code.size()-1); 
     auto out = osstream();
 
     // Render each loop frame (used by nested FOR instructions)
@@ -64,7 +75,7 @@ class ProcessProgram {
   }
 
   // ------ Instance variables ------
-  vec<Instruction> script;
+  ProgramCode code;
   ContextStack context;
   bool is_terminated;
   bool ip_was_set;
@@ -76,11 +87,12 @@ class ProcessProgram {
   /** @brief Helper to renders a single instruction line from the script with formatting. */
   auto render_line(uint idx, uint width) -> str {
     char marker = (idx == ip) ? '>' : ' ';
-    auto opcode = script[idx].opcode.substr(0, 10);
+    auto inst = code.decode(idx);
+    auto opcode = inst.opcode.substr(0, 10);
     auto line = osstream();
     line << format("{} [{:0{}}] {:<{}}", marker, idx, width, opcode, 10);
 
-    for (auto& arg: script[idx].args)
+    for (auto& arg: inst.args)
       line << ' ' << arg;
     line << '\n';
     return line.str();
@@ -89,7 +101,7 @@ class ProcessProgram {
   /** @brief Helper to renders a single loop frame from the context stack with formatting. */
   auto render_frame(uint idx, uint width) -> str {
     auto& frame = context.at(idx);
-    auto& inst = script[frame.ip];
+    auto inst = code.decode(frame.ip);
     auto out = osstream();
 
     out << format("  [{}]", idx);
@@ -0,0 +1,231 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+#include "core/instruction/Instruction.hpp"
+
+
+/**
+ * @brief Compactly encoded process code, decoded on demand one region at a time.
+ *
+ * A `vec<Instruction>` costs a `std::string` per opcode and a `vec<str>` per
+ * argument list, which dominates host memory once scripts grow long. Here
+ * the script is kept encoded:
+ * - one opcode byte per instruction (an index into the program's opcode table,
+ *   kept apart from the string table so argument names can't push it past a byte),
+ * - argument bytes: small unsigned numbers as LEB128 varints, anything else as
+ *   a varint index into the program's deduplicated string table,
+ * - the byte offset of every region of `REGION_SIZE` instructions.
+ *
+ * `at()` decodes the region around the instruction pointer and keeps at most
+ * `MAX_RESIDENT` regions decoded (least recently used goes first); `evict()`
+ * drops them all, so dormant processes hold only their encoded form.
+ * FOR/ENDFOR exit addresses live in a sparse map so they survive eviction.
+ */
+class ProgramCode {
+  public:
+  static constexpr uint REGION_BITS  = 4;
+  static constexpr uint REGION_SIZE  = 1u << REGION_BITS;
+  static constexpr uint MAX_RESIDENT = 2;
+
+  ProgramCode(const vec<Instruction>& script):
+    count     (cast<uint>(script.size())),  // Number of instructions
+    opcodes   (vec<byte>()),               // Opcode index of each instruction
+    bytes     (vec<byte>()),               // Encoded argument lists, back to back
+    offsets   (vec<uint>()),                // Byte offset of the first instruction of each region
+    ops       (vec<str>()),                 // Opcode names (deduplicated, at most 256)
+    names     (vec<str>()),                 // String arguments (deduplicated)
+    exits     (umap<uint,uint>()),          // Cached exit address of control-flow instructions
+    resident  (list<tup<uint,vec<Instruction>>>()),  // Decoded regions, most recently used first
+    full_size (0u)                          // Host bytes the script took as a vec<Instruction>
+  {
+    auto ids = umap<str,uint>(), op_ids = umap<str,uint>();
+    auto intern = [&](const str& name) {
+      auto [it, added] = ids.emplace(name, cast<uint>(names.size()));
+      if (added) names.push_back(name);
+      return it->second;
+    };
+    auto intern_op = [&](const str& opcode) {
+      auto [it, added] = op_ids.emplace(opcode, cast<uint>(ops.size()));
+      if (added) ops.push_back(opcode);
+      if (it->second > 0xFF)
+        throw runtime_error(format("ProgramCode: more than 256 distinct opcodes (at '{}')", opcode));
+      return it->second;
+    };
+
+    full_size = script.capacity() * sizeof(Instruction);
+    opcodes.reserve(count);
+    for (auto ip = 0u; ip < count; ++ip) {
+      auto& inst = script[ip];
+      if (ip % REGION_SIZE == 0)
+        offsets.push_back(bytes.size());
+
+      opcodes.push_back(cast<byte>(intern_op(inst.opcode)));
+      put_varint(inst.args.size());
+      for (auto& arg : inst.args) {
+        if (auto number = as_number(arg)) {
+          bytes.push_back(NUMBER);
+          put_varint(*number);
+        } else {
+          bytes.push_back(NAME);
+          put_varint(intern(arg));
+        }
+      }
+      if (inst.exit != 0)
+        exits[ip] = inst.exit;
+
+      full_size += heap_size(inst.opcode) + inst.args.capacity() * sizeof(str);
+      for (auto& arg : inst.args)
+        full_size += heap_size(arg);
+    }
+    bytes.shrink_to_fit();
+    offsets.shrink_to_fit();
+  }
+
+  /** @brief Returns the number of instructions. */
+  auto size() -> uint { return count; }
+
+  /** @brief Returns the instruction at `ip`, decoding its region if it isn't resident. */
+  auto at(uint ip) -> Instruction& {
+    if (ip >= count)
+      throw out_of_range(format("ProgramCode::at: instruction {} out of range", ip));
+
+    auto region = ip >> REGION_BITS;
+    auto it = std::ranges::find_if(resident, [&](auto& entry) { return get<0>(entry) == region; });
+    if (it != resident.end())
+      resident.splice(resident.begin(), resident, it);  // Mark most recently used
+    else {
+      if (resident.size() >= MAX_RESIDENT)
+        resident.pop_back();
+      resident.emplace_front(region, decode_region(region));
+    }
+    return get<1>(resident.front())[ip & (REGION_SIZE - 1)];
+  }
+
+  /** @brief Decodes one instruction without making its region resident (for listings). */
+  auto decode(uint ip) -> Instruction {
+    auto pos = cast<size_t>(offsets[ip >> REGION_BITS]);
+    for (auto i = ip & ~(REGION_SIZE - 1); i < ip; ++i)
+      skip_instruction(pos);
+    return read_instruction(ip, pos);
+  }
+
+  /** @brief Returns the opcode of an instruction without decoding it. */
+  auto opcode_at(uint ip) -> const str& { return ops[opcodes.at(ip)]; }
+
+  /** @brief Records the exit address of a control-flow instruction (kept across evictions). */
+  void set_exit(uint ip, uint exit) {
+    exits[ip] = exit;
+    for (auto& [region, insts] : resident)
+      if (region == ip >> REGION_BITS)
+        insts[ip & (REGION_SIZE - 1)].exit = exit;
+  }
+
+  /** @brief Drops every decoded region; the encoded form stays. */
+  void evict() { resident.clear(); }
+
+  /** @brief Returns the host bytes of the encoded form. */
+  auto encoded_bytes() -> uint64 {
+    auto total = sizeof(ProgramCode) + opcodes.capacity() + bytes.capacity() + offsets.capacity() * sizeof(uint)
+      + (ops.capacity() + names.capacity()) * sizeof(str) + exits.size() * 2 * sizeof(uint);
+    for (auto& op : ops)
+      total += heap_size(op);
+    for (auto& name : names)
+      total += heap_size(name);
+    return total;
+  }
+
+  /** @brief Returns the host bytes of the currently decoded regions. */
+  auto resident_bytes() -> uint64 {
+    auto total = 0ull;
+    for (auto& [_, insts] : resident) {
+      total += insts.capacity() * sizeof(Instruction);
+      for (auto& inst : insts) {
+        total += heap_size(inst.opcode) + inst.args.capacity() * sizeof(str);
+        for (auto& arg : inst.args)
+          total += heap_size(arg);
+      }
+    }
+    return total;
+  }
+
+  /** @brief Returns the host bytes the script took as a plain vec<Instruction>. */
+  auto decoded_bytes() -> uint64 { return full_size; }
+
+  private:
+
+  // ------ Member variables ------
+  uint count;
+  vec<byte> opcodes;
+  vec<byte> bytes;
+  vec<uint> offsets;
+  vec<str> ops;
+  vec<str> names;
+  umap<uint,uint> exits;
+  list<tup<uint,vec<Instruction>>> resident;
+  uint64 full_size;
+
+  static constexpr byte NUMBER = 0;  // Argument tag: varint value
+  static constexpr byte NAME   = 1;  // Argument tag: varint index into names
+
+  /** @brief Returns the value of a plain decimal argument that round-trips exactly (no hex, no leading zeros). */
+  static auto as_number(const str& arg) -> opt<uint> {
+    if (arg.empty() || arg.size() > 9 || !is_digits(arg) || (arg.size() > 1 && arg[0] == '0'))
+      return nullopt;
+    return stoui(arg);
+  }
+
+  /** @brief Returns the heap bytes a string owns beyond its inline (small-string) buffer. */
+  static auto heap_size(const str& s) -> uint64 {
+    return s.capacity() > str().capacity() ? s.capacity() + 1 : 0;
+  }
+
+  void put_varint(uint64 value) {
+    do {
+      auto low = cast<byte>(value & 0x7F);
+      value >>= 7;
+      bytes.push_back(value ? low | 0x80 : low);
+    } while (value);
+  }
+
+  auto get_varint(size_t& pos) -> uint64 {
+    auto value = 0ull;
+    for (auto shift = 0u; ; shift += 7) {
+      auto next = bytes[pos++];
+      value |= cast<uint64>(next & 0x7F) << shift;
+      if (!(next & 0x80)) return value;
+    }
+  }
+
+  void skip_instruction(size_t& pos) {
+    auto argc = get_varint(pos);
+    for (auto i = 0u; i < argc; ++i) {
+      ++pos;  // Tag
+      get_varint(pos);
+    }
+  }
+
+  auto read_instruction(uint ip, size_t& pos) -> Instruction {
+    auto inst = Instruction{ ops[opcodes[ip]], {} };
+    auto argc = get_varint(pos);
+    inst.args.reserve(argc);
+    for (auto i = 0u; i < argc; ++i) {
+      auto tag = bytes[pos++];
+      auto value = get_varint(pos);
+      inst.args.push_back(tag == NUMBER ? std::to_string(value) : names[value]);
+    }
+    if (auto it = exits.find(ip); it != exits.end())
+      inst.exit = it->second;
+    return inst;
+  }
+
+  auto decode_region(uint region) -> vec<Instruction> {
+    auto first = region << REGION_BITS;
+    auto last = min(count, first + REGION_SIZE);
+    auto insts = vec<Instruction>();
+    insts.reserve(last - first);
+
+    auto pos = cast<size_t>(offsets[region]);
+    for (auto ip = first; ip < last; ++ip)
+      insts.push_back(read_instruction(ip, pos));
+    return insts;
+  }
+};
@@ -1,8 +1,29 @@
 #pragma once
 #include "core/common/imports/_all.hpp"
 #include "core/instruction/Instruction.hpp"
+#include "core/memory/types.hpp"
 
 
+/** A declared variable and the last translation of its address. */
+struct Symbol {
+  uint vaddr;                 // Virtual address of the variable's 2 bytes
+  opt<Translation> cache;     // Resolved frame and offset (stale once the memory epoch moves)
+};
+
+/** Real-time attributes of a process (times in scheduler ticks) and its deadline record. */
+struct RealTime {
+  uint deadline = 0;  // Relative deadline of each job (0 = the period)
+  uint period   = 0;  // Time between job releases (0 = a single, aperiodic job)
+  uint jobs     = 0;  // Jobs completed or overdue so far
+  uint misses   = 0;  // Jobs that ran past their deadline
+
+  /** Returns true if the process has a deadline at all. */
+  auto enabled() const -> bool { return deadline > 0 || period > 0; }
+
+  /** Returns the ticks from a job's release to its deadline. */
+  auto window() const -> uint { return deadline > 0 ? deadline : period; }
+};
+
 /** A loop frame from a FOR-like instruction. */
 struct ContextFrame {
   uint ip;    // Address where the loop starts
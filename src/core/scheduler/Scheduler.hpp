@@ -18,14 +18,14 @@ class Scheduler {
   public:
 
   Scheduler():
-    spawn_reqs (vec<tup<str,uint>>()),  // Deferred generation list for user-inserted process table
-    ticks      (0u),                    // Global tick counter
     generating (false),                 // Flag indicating auto-generation mode
     data       (SchedulerData()),       // Internal state (cores, process table, vec<str>)
     strategy   (SchedulerStrategy()) {} // Contains the scheduler strategy
 
   /** Adds a user-named process to the pending generation vec<str>. */
-  void generate_process(str name, uint size) { spawn_reqs.emplace_back(move(name), size); }
+  void generate_process(str name, uint size, bool huge=false, uint rss=0u, uint weight=0u, int nice=0, RealTime rt={}) {
+    data.spawn_reqs.push_back({ move(name), size, huge, rss, weight, nice, rt });
+  }
 
   /** Enables or disables automatic process generation each tick. */
   void generate(bool flag) { generating = flag; }
@@ -44,9 +44,29 @@ class Scheduler {
       // Tick sleeping processes in the waiting queue
       tick_sleeping_processes();
 
+      // Swap long sleepers out under memory pressure, and back in before they wake
+      swap_sleeping_processes();
+
+      // Mark pages whose backing-store reads have finished as resident
+      data.memory.poll();
+
+      // Age page access counters so the heatmap tracks recent behaviour
+      if (heat_decay_elapsed())
+        data.memory.decay_heat();
+
+      // Move hot pages into the fast tier and cold pages out of it
+      data.memory.balance_tiers(data.config.getu("tier-migrate-rate"), data.config.getu("tier-promote-heat"));
+
+      // Defragment free frames (rate-limited), then collapse fully resident regions of huge-page processes
+      data.memory.compact(data.config.getu("compaction-rate"));
+      data.memory.promote_huge_pages();
+
       // Assign new processes to idle cores
       strategy.tick(data);
-      ++ticks;
+
+      // Tell page replacement which processes run next
+      publish_run_hints();
+      ++data.ticks;
 
     } catch (exception& e) {
       cerr << format("[Scheduler] tick(): Exception: {}\n", e.what());
@@ -54,6 +74,32 @@ class Scheduler {
     }
   }
 
+  /** @brief Returns true if a core has a job waiting to be released (see react()). */
+  auto has_events() -> bool {
+    return data.config.getb("initialized") && !data.cores.get_releasable().empty();
+  }
+
+  /**
+   * @brief Handles core events between ticks: releases finished, sleeping or
+   * preempted jobs and refills the freed cores right away.
+   *
+   * The clock doesn't advance, so sleep counters, generation and memory
+   * maintenance still run once per tick().
+   */
+  void react() {
+    if (!data.config.getb("initialized")) return;
+
+    try {
+      release_processes();
+      strategy.tick(data);
+      publish_run_hints();
+
+    } catch (exception& e) {
+      cerr << format("[Scheduler] react(): Exception: {}\n", e.what());
+      throw;
+    }
+  }
+
   /** @brief Applies a new configuration and resizes core state accordingly. */
   void set_config(Config config) {
     
@@ -63,26 +109,37 @@ class Scheduler {
     data.memory.init(memory_capacity, page_size, [&](uint pid) {
       return !data.cores.is_running(pid);  // true if process is currently preempted
     });
+    data.memory.set_tiers(config.getu("slow-tier-frames"), config.getu("slow-tier-cost"));
+    data.memory.set_huge_pages(config.getu("huge-page-factor"), config.getb("huge-pages"));
+    data.memory.set_default_rss_cap(config.getu("max-rss-per-proc"));
+    data.memory.set_replacement(config.gets("page-replacement"));
+    data.memory.set_sleep_hints([&](uint pid) -> opt<uint> {
+      if (!data.wqueue.contains(pid)) return nullopt;
+      return data.sleep_left(pid);
+    });
+    data.memory.set_numa(config.getu("numa-nodes"), config.gets("numa-policy"), config.getu("numa-remote-cost"),
+      [&](uint pid) {
+        return data.has_process(pid) ? data.node_of_core(data.get_process(pid).data.core_id) : 0u;
+      });
 
     // Initialize CPU cores
-    strategy = get_scheduler_strategy(config.gets("scheduler"));
-    auto preempt_handler = strategy.get_preempt_handler(data);  // Create handler from factory method
+    auto strategy_name = config.gets("scheduler");
     auto core_size = config.getu("num-cpu");
     auto delay = config.getu("delays-per-exec");
+    data.config = move(config); // Strategies read their settings from data.config
+
+    strategy = get_scheduler_strategy(strategy_name);
+    auto preempt_handler = strategy.get_preempt_handler(data);  // Create handler from factory method
     data.cores.init(core_size);
 
     for (auto& ref: data.cores.get_all()) {
       auto& core = ref.get();
       core.init(delay, preempt_handler);
     }
-
-    data.config = move(config); // Must come last                               
   }
 
   // ------ Instance variables ------
 
-  vec<tup<str,uint>> spawn_reqs;                
-  uint ticks;             
   bool generating;    
   SchedulerData data;         
   SchedulerStrategy strategy;
@@ -94,12 +151,18 @@ class Scheduler {
   /** @brief Helper that checks if the current tick matches the process generation interval. */
   auto interval_has_elapsed() -> bool {
     uint freq = data.config.getu("batch-process-freq");
-    return freq > 0 && (ticks % freq == 0);
+    return freq > 0 && (data.ticks % freq == 0);
+  }
+
+  /** @brief Helper that checks if the current tick matches the heat decay interval. */
+  auto heat_decay_elapsed() -> bool {
+    uint period = data.config.getu("heat-decay-ticks");
+    return period > 0 && (data.ticks % period == 0);
   }
 
   /** @brief Helper that generates user and scheduler-enqueued processes. */
   void generate_processes() {
-    auto make_process = [&](uint pid, str name="", uint size=0u) {
+    auto make_process = [&](uint pid, str name="", uint size=0u, bool huge=false, uint rss=0u, uint weight=0u, int nice=0, RealTime rt={}) {
       auto& config = data.config;
       auto pname = name.empty() ? format("p{:02}", pid) : move(name);
 
@@ -114,53 +177,116 @@ class Scheduler {
       auto mem_size = size == 0 ? Rand::num(min_mem, max_mem) : size;
 
       // === Auto-alloc and get view (failsafe inside create_memory_view_for)
-      auto view = data.memory.create_memory_view_for(pid, mem_size);
+      auto view = data.memory.create_memory_view_for(pid, mem_size, huge);
+      if (rss > 0)
+        data.memory.set_rss_cap(pid, rss);
 
       // === Add to process table and ready queue
-      data.add_process(Process(pid, move(pname), move(view), ins_size));
+      auto process = Process(pid, move(pname), move(view), ins_size);
+      process.data.weight = weight > 0 ? weight : max(1u, config.getu("default-weight"));
+      process.data.nice = nice;
+      process.data.rt = rt;
+      data.add_process(move(process));
       data.rqueue.push(pid);
     };
 
-    for (auto& [name, size]: spawn_reqs)
-      make_process(data.new_pid(), move(name), size);
-    spawn_reqs.clear();
+    for (auto& [name, size, huge, rss, weight, nice, rt]: data.spawn_reqs)
+      make_process(data.new_pid(), move(name), size, huge, rss, weight, nice, rt);
+    data.spawn_reqs.clear();
 
     if (generating && interval_has_elapsed())
       make_process(data.new_pid());
   }
 
+  /**
+   * @brief Helper that tells hinted page replacement which processes run next.
+   * Other policies never read the hints, so they pay nothing; sleepers are
+   * looked up lazily, so this costs O(running + ready) rather than O(sleepers).
+   */
+  void publish_run_hints() {
+    if (!data.memory.wants_run_hints()) return;
+    auto ready = strategy.ready(data);
+    auto behind = cast<uint>(ready.size()) + 1;
+    data.memory.publish_run_hints(data.run_distances(ready), behind);
+  }
+
   /** @brief Helper that releases finished or preempted processes in cores. */
   void release_processes() {
     for (auto& ref: data.cores.get_releasable()) {
       auto& core = ref.get();
       auto& process = core.get_job();
+      strategy.release(data, core);  // Strategy sees the job's run before it's cleared
       core.release();
+      data.memory.record_working_set(process.data.id);
+      process.data.program.code.evict();  // Off-core code keeps only its encoded form
 
       if (process.data.program.finished()) {
+        process.data.ftime = Clock::now();
         data.finished_pids.push_back(process.data.id);
         data.memory.release_all_frames_for(process.data.id);  // Clean up memory pages and eviction queue
       }
 
       else if (process.data.control.sleeping())
-        data.wqueue.push_back(process.data.id);     
+        data.wqueue.schedule(process.data.id, wake_tick(process));
       else                                      
         data.rqueue.push(process.data.id);  // Not finished, not sleeping → just resume later
     }
   }
 
-  /** @brief Steps processes in wqueue. Returns processes to the ready queue once they're not sleeping. */
+  /**
+   * @brief The swapper: moves whole resident sets of long sleepers to the backing store.
+   *
+   * While fewer than `swap-low-frames` frames are free, sleepers with at least
+   * `swap-min-sleep` ticks left are swapped out, longest sleep first. A swapped
+   * process is brought back `swap-in-lead` ticks before its sleep ends, so it
+   * wakes up mostly resident instead of faulting its pages back one by one.
+   * Swap-ins are timers in `data.swapins`; sleepers are only scanned for
+   * swap-out candidates while memory is actually low.
+   */
+  void swap_sleeping_processes() {
+    auto min_sleep = data.config.getu("swap-min-sleep");
+    if (min_sleep == 0) return;
+
+    // Swap in first, so frames freed below aren't handed straight back
+    auto& memory = data.memory;
+    for (auto pid : data.swapins.expire(data.ticks))
+      if (data.wqueue.contains(pid))
+        memory.swap_in(pid);
+
+    auto low = data.config.getu("swap-low-frames");
+    if (memory.data.free_count() >= low) return;
+
+    auto sleep_of = [&](uint pid) { return data.sleep_left(pid); };
+    auto candidates = vec<uint>();
+    for (auto pid : data.wqueue.pids())
+      if (!memory.is_swapped(pid) && sleep_of(pid) >= min_sleep)
+        candidates.push_back(pid);
+
+    std::ranges::sort(candidates, std::greater<>(), sleep_of);
+    auto lead = data.config.getu("swap-in-lead");
+    for (auto pid : candidates) {
+      if (memory.data.free_count() >= low) break;
+      memory.swap_out(pid);
+      data.swapins.schedule(pid, *data.wqueue.fires_at(pid) - min(lead, sleep_of(pid)));
+    }
+  }
+
+  /**
+   * @brief Returns the tick a process released asleep wakes at.
+   *
+   * Sleep counts down once per tick starting with the next tick() to run
+   * (this one, if releasing during it), after any remote-access stall it owes.
+   */
+  auto wake_tick(Process& process) -> uint64 {
+    auto& stall = process.data.memory.virtual_memory.stall_cycles;
+    return cast<uint64>(data.ticks) + stall + process.data.control.sleep_ticks - 1;
+  }
+
+  /** @brief Returns sleepers whose wake tick has come to the ready queue. */
   void tick_sleeping_processes() {
-    auto& wqueue = data.wqueue;
-    for (auto it = wqueue.begin(); it != wqueue.end(); ) {
-      auto& process = data.get_process(*it);
-      process.step();           // decrement sleep_ticks
-
-      if (process.data.control.sleeping())
-        ++it;                   // still sleeping
-      else {
-        data.rqueue.push(*it);  // ready again
-        it = wqueue.erase(it);  // remove from wqueue  
-      }
+    for (auto pid : data.wqueue.expire(data.ticks)) {
+      data.get_process(pid).wake();
+      data.rqueue.push(pid);
     }
   }
 };
@@ -3,6 +3,7 @@
 #include "core/process/Process.hpp"
 #include "core/execution/CoreManager.hpp"
 #include "core/memory/MemoryManager.hpp"
+#include "TimerWheel.hpp"
 #include "types.hpp"
 
 
@@ -19,11 +20,14 @@ class SchedulerData {
     proc_table    (umap<uint,uptr<Process>>()), // Container for all processes
     finished_pids (vec<uint>()),                // PIDs of Finished processes 
     rqueue        (queue<uint>()),              // Ready queue of processes waiting to be scheduled
-    wqueue        (list<uint>()),               // Ready queue of processes waiting to be scheduled
+    spawn_reqs    (vec<SpawnRequest>()),        // User-requested processes created on the next tick
+    wqueue        (TimerWheel()),               // Sleeping processes, keyed by wake tick
+    swapins       (TimerWheel()),               // Swapped-out sleepers, keyed by the tick to bring them back
     next_pid      (atomic_uint{1}),             // PID counter for generating unique process IDs
     config        (Config()),                   // Runtime configuration settings
     cores         (CoreManager()),              // Owned instance of core manager
-    memory        (MemoryManager()) {}          // Owned instance of memory manager
+    memory        (MemoryManager()),            // Owned instance of memory manager
+    ticks         (0u) {}                       // Scheduler ticks elapsed (the simulation clock)
 
   /** @brief Returns a unique, incrementing process ID. */
   auto new_pid() -> uint { return next_pid++; }
@@ -47,6 +51,52 @@ class SchedulerData {
   /** @brief Returns a reference wrapper to the process with the given name. */
   auto get_process(const str& name) -> Process& { return *find_process_by_name(name); }
   
+  /** @brief Returns the mean creation-to-finish time of finished processes (nullopt if none). */
+  auto average_turnaround() -> opt<ms> {
+    auto total = ms(0);
+    auto count = 0u;
+    for (auto pid : finished_pids) {
+      auto& process = get_process(pid);
+      if (!process.data.ftime) continue;
+      total += duration_cast<ms>(*process.data.ftime - process.data.stime);
+      ++count;
+    }
+    if (count == 0) return nullopt;
+    return total / count;
+  }
+
+  /** @brief Returns the cores' worth of CPU a real-time process needs: worst-case cycles over its deadline window. */
+  auto realtime_demand(uint64 cycles, const RealTime& rt) -> double {
+    if (!rt.enabled()) return 0.0;
+    auto window = cast<double>(rt.period > 0 ? min(rt.window(), rt.period) : rt.window());
+    return cycles / (window * max(1u, config.getu("edf-cycles-per-tick")));
+  }
+
+  /**
+   * @brief Returns the summed demand of every unfinished real-time process,
+   * including admitted spawn requests not created yet (at their worst case, `max-ins`).
+   */
+  auto realtime_utilization() -> double {
+    auto total = 0.0;
+    for (auto& [_, process] : proc_table)
+      if (!process->data.program.finished())
+        total += realtime_demand(process->data.program.size(), process->data.rt);
+    for (auto& request : spawn_reqs)
+      total += realtime_demand(config.getu("max-ins"), request.rt);
+    return total;
+  }
+
+  /**
+   * @brief EDF admission test: accepts a new real-time process only if the
+   * total demand stays within the number of cores.
+   * @return The demand after admission, or nullopt if it would overload.
+   */
+  auto admit_realtime(uint64 cycles, const RealTime& rt) -> opt<double> {
+    auto total = realtime_utilization() + realtime_demand(cycles, rt);
+    if (total > cores.size()) return nullopt;
+    return total;
+  }
+
   /** @brief Returns the vec<uint> of running process IDs. */
   auto get_running_pids() -> vec<uint> { return cores.get_running_pids(); }
 
@@ -55,7 +105,8 @@ class SchedulerData {
    *
    * A process is eligible to run if:
    * - At least one of its pages is already loaded, OR
-   * - At least one free frame exists to satisfy future faults.
+   * - At least one free frame exists to satisfy future faults, OR
+   * - The replacement policy lets its faults evict other processes' pages.
    */
   auto memory_available_for(uint pid) -> bool {
     
@@ -77,24 +128,71 @@ class SchedulerData {
     auto& page_table = memory.data.page_table_map.at(pid);
     // cout << format("[debug] PID {} has {} pages and {} free frames\n", pid, page_table.pages().size(), memory.data.free_frames.size());
 
-    // If any of its pages are loaded, it's good to run
+    // If any of its pages hold a frame (loaded or loading), it's good to run
     for (auto page_num : page_table.pages())
-      if (page_table.get(page_num).is_loaded())
+      if (page_table.get(page_num).has_frame())
         return true;
 
     // Otherwise, check if there's at least one free frame
-    return !memory.data.free_frames.empty();
+    return memory.data.free_count() > 0 || memory.can_steal_frame();
+  }
+
+  /**
+   * @brief Assigns a process to a core, prefetching its last working set first
+   *        so it doesn't fault its pages back in one retried instruction at a time.
+   */
+  void dispatch(Core& core, uint pid) {
+    auto& process = get_process(pid);
+    core.assign(process);  // First, so first-touch placement sees the new core
+    process.data.memory.virtual_memory.node = node_of_core(core.id);  // Cached for per-access NUMA accounting
+    memory.data.stats.add("dispatches");
+    if (memory.is_swapped(pid))
+      memory.swap_in(pid);  // Woke before the swapper brought it back
+    else if (config.getb("prefetch-on-dispatch"))
+      memory.prefetch_working_set(pid);
+  }
+
+  /**
+   * @brief Estimates how many dispatches away each running or ready process is from running.
+   *
+   * Running processes are 0 and ready processes follow their position in
+   * `ready` (dispatch order). Sleepers come after all of them; their distance
+   * is looked up on demand from `wqueue` (see MemoryManager::set_sleep_hints).
+   */
+  auto run_distances(const vec<uint>& ready) -> umap<uint,uint> {
+    auto distances = umap<uint,uint>();
+    for (auto pid : get_running_pids())
+      distances[pid] = 0;
+
+    for (auto position = 0u; position < ready.size(); ++position)
+      distances[ready[position]] = position + 1;
+    return distances;
+  }
+
+  /** @brief Returns how many ticks after the current one a sleeper in `wqueue` wakes (0 if not sleeping). */
+  auto sleep_left(uint pid) -> uint {
+    auto wake = wqueue.fires_at(pid);
+    return wake && *wake > ticks ? cast<uint>(*wake - ticks) : 0u;
+  }
+
+  /** @brief Returns the NUMA node of a core. Cores are split into equal consecutive groups per node. */
+  auto node_of_core(uint core_id) -> uint {
+    if (core_id == 0 || cores.size() == 0) return 0;  // Never scheduled
+    return (core_id - 1) * memory.data.numa_nodes / cores.size();
   }
 
   // ------ Instance variables ------
   umap<uint, uptr<Process>> proc_table;
   vec<uint> finished_pids;         
   queue<uint> rqueue;                 
-  list<uint> wqueue;                 
+  vec<SpawnRequest> spawn_reqs;
+  TimerWheel wqueue;
+  TimerWheel swapins;
   atomic_uint next_pid;           
   Config config;
   CoreManager cores;
   MemoryManager memory;
+  uint ticks;
 
   // ------ Internal logic ------
   private:
@@ -16,11 +16,17 @@ class SchedulerStrategy {
 
   using PreemptFactory = func<Core::func(SchedulerData&)>;
   using TickHandler = func<void(SchedulerData&)>;
+  using ReleaseHandler = func<void(SchedulerData&, Core&)>;
+  using ReadyView = func<vec<uint>(SchedulerData&)>;
+  using ReportHandler = func<str(SchedulerData&)>;
 
   SchedulerStrategy():
     name            (""s),                // Strategy identifier (e.g., "fcfs", "rr")
     tick_handler    (nullptr),            // Main strategy logic executed each tick
-    preempt_factory (nullptr) {}          // Core-level preemption policy (optional)
+    preempt_factory (nullptr),            // Core-level preemption policy (optional)
+    release_handler (nullptr),            // Sees each job as it leaves its core (optional)
+    ready_view      (nullptr),            // Ready processes in dispatch order (optional; defaults to rqueue)
+    report_handler  (nullptr) {}          // Extra status lines for screen -ls (optional)
 
   /** @brief Sets the strategy name. */
   auto set_name(str n) -> SchedulerStrategy& { return name = n, *this; }
@@ -31,6 +37,15 @@ class SchedulerStrategy {
   /** @brief Sets the per-core preemption policy. */
   auto on_preempt(PreemptFactory f) -> SchedulerStrategy& { return preempt_factory = move(f), *this;}
 
+  /** @brief Sets the handler run when a job leaves its core (before it is requeued). */
+  auto on_release(ReleaseHandler r) -> SchedulerStrategy& { return release_handler = move(r), *this; }
+
+  /** @brief Sets how the ready processes are listed, for strategies that keep their own ready structure. */
+  auto on_ready(ReadyView v) -> SchedulerStrategy& { return ready_view = move(v), *this; }
+
+  /** @brief Sets the handler that renders strategy-specific status. */
+  auto on_report(ReportHandler r) -> SchedulerStrategy& { return report_handler = move(r), *this; }
+
   /** @brief Returns a Core-level preemption lambda bound to current SchedulerData. */
   auto get_preempt_handler(SchedulerData& data) -> Core::func {
     if (!preempt_factory) return nullptr;
@@ -39,16 +54,42 @@ class SchedulerStrategy {
 
   // === Execution ===
 
-  /** @brief Invokes the tick handler logic on the current scheduler data. */
+  /**
+   * @brief Invokes the tick handler logic on the current scheduler data.
+   *
+   * Runs every tick and again whenever cores free up between ticks, so
+   * handlers must read time from `data.ticks` rather than count calls.
+   */
   void tick(SchedulerData& data) {
     if (!tick_handler)
       throw runtime_error("SchedulerStrategy::tick called without on_tick handler.");
     tick_handler(data);
   }
 
+  /** @brief Notifies the strategy that the job on `core` is about to be released. */
+  void release(SchedulerData& data, Core& core) {
+    if (release_handler) release_handler(data, core);
+  }
+
+  /** @brief Returns the ready processes in the order the strategy would dispatch them. */
+  auto ready(SchedulerData& data) -> vec<uint> {
+    if (ready_view) return ready_view(data);
+
+    auto pids = vec<uint>();
+    for (auto queue = data.rqueue; !queue.empty(); queue.pop())
+      pids.push_back(queue.front());
+    return pids;
+  }
+
+  /** @brief Returns strategy-specific status lines (empty if none). */
+  auto report(SchedulerData& data) -> str { return report_handler ? report_handler(data) : ""s; }
+
   // ------ Instance variables ------
 
   str name;              
   TickHandler tick_handler;       
   PreemptFactory preempt_factory;
+  ReleaseHandler release_handler;
+  ReadyView ready_view;
+  ReportHandler report_handler;
 };
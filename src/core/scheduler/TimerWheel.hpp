@@ -0,0 +1,140 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+
+
+/**
+ * @brief Hierarchical timing wheel of process timers, keyed by absolute tick.
+ *
+ * Responsibilities:
+ * - Holds each pid in a slot chosen by how far away its tick is: level 0 has
+ *   one slot per tick for the next 64 ticks, and every level above has slots
+ *   64 times wider than the one below.
+ * - `expire()` advances the wheel's clock and returns the pids whose tick was reached.
+ *
+ * Key Behaviors:
+ * - Scheduling and cancelling are O(1): slots are lists, and each pid's list
+ *   position is indexed.
+ * - Advancing one tick empties one level-0 slot. Every 64^k ticks one level-k
+ *   slot cascades its pids into the levels below, so a timer moves at most
+ *   once per level and the cost of a tick follows the number of timers firing,
+ *   not the number waiting.
+ * - Ticks already passed fire on the next `expire()`. Ticks beyond the top
+ *   level's range wait in its farthest slot and are re-placed when it cascades.
+ */
+class TimerWheel {
+  public:
+  static constexpr uint LEVELS    = 4;                ///< Wheel levels (range 64^4 ticks before re-placing)
+  static constexpr uint SLOT_BITS = 6;                ///< log2 of the slots per level
+  static constexpr uint SLOTS     = 1u << SLOT_BITS;  ///< Slots per level
+
+  using Slot = list<tup<uint,uint64>>;  // (pid, tick)
+
+  /** @brief Position of a pending timer. */
+  struct Handle {
+    uint level;
+    uint slot;
+    Slot::iterator pos;
+  };
+
+  TimerWheel():
+    wheel (array<array<Slot,SLOTS>,LEVELS>()),  // Timers per level and slot
+    index (umap<uint,Handle>()),                // pid: where its timer sits
+    now   (0u) {}                               // Next tick expire() will process
+
+  /** @brief Sets `pid` to fire at tick `at`, replacing its previous timer. */
+  void schedule(uint pid, uint64 at) {
+    cancel(pid);
+    place(pid, max(at, now));
+  }
+
+  /** @brief Removes the timer of `pid`. Returns false if it had none. */
+  auto cancel(uint pid) -> bool {
+    auto it = index.find(pid);
+    if (it == index.end()) return false;
+
+    auto& [level, slot, pos] = it->second;
+    wheel[level][slot].erase(pos);
+    index.erase(it);
+    return true;
+  }
+
+  /** @brief Advances the clock through `tick` and returns the pids that fired, earliest first. */
+  auto expire(uint64 tick) -> vec<uint> {
+    auto fired = vec<uint>();
+    if (index.empty()) {
+      now = max(now, tick + 1);  // Nothing to cascade or fire on the way
+      return fired;
+    }
+
+    for (; now <= tick; ++now) {
+      cascade();
+      auto& slot = wheel[0][now & (SLOTS - 1)];
+      for (auto& [pid, _] : slot) {
+        fired.push_back(pid);
+        index.erase(pid);
+      }
+      slot.clear();
+    }
+    return fired;
+  }
+
+  /** @brief Returns the tick `pid` fires at, or nullopt if it has no timer. */
+  auto fires_at(uint pid) const -> opt<uint64> {
+    auto it = index.find(pid);
+    if (it == index.end()) return nullopt;
+    return get<1>(*it->second.pos);
+  }
+
+  /** @brief Returns true if `pid` has a pending timer. */
+  auto contains(uint pid) const -> bool { return index.contains(pid); }
+
+  /** @brief Returns the pids with a pending timer (in no particular order). */
+  auto pids() const -> vec<uint> {
+    auto result = vec<uint>();
+    result.reserve(index.size());
+    for (auto& [pid, _] : index)
+      result.push_back(pid);
+    return result;
+  }
+
+  /** @brief Returns the number of pending timers. */
+  auto size() const -> uint { return cast<uint>(index.size()); }
+
+  /** @brief Returns true if no timers are pending. */
+  auto empty() const -> bool { return index.empty(); }
+
+  // ------ Internal logic ------
+  private:
+  array<array<Slot,SLOTS>,LEVELS> wheel;
+  umap<uint,Handle> index;
+  uint64 now;
+
+  /** @brief Puts a timer in the lowest level whose range reaches `at` (at >= now). */
+  void place(uint pid, uint64 at) {
+    auto delta = at - now;
+    auto level = 0u;
+    while (level + 1 < LEVELS && delta >= uint64(1) << (SLOT_BITS * (level + 1)))
+      ++level;
+
+    // Beyond the top level's range: park in its farthest slot until it cascades
+    auto key = min(at, now + (uint64(1) << (SLOT_BITS * LEVELS)) - 1);
+    auto slot = cast<uint>((key >> (SLOT_BITS * level)) & (SLOTS - 1));
+    auto& bucket = wheel[level][slot];
+    bucket.emplace_back(pid, at);
+    index[pid] = { level, slot, std::prev(bucket.end()) };
+  }
+
+  /** @brief Moves the timers of each higher-level slot that starts at `now` down the wheel. */
+  void cascade() {
+    for (auto level = 1u; level < LEVELS; ++level) {
+      auto shift = SLOT_BITS * level;
+      if (now & ((uint64(1) << shift) - 1))
+        break;  // Not a slot boundary at this level, so not at any higher one either
+
+      auto moving = Slot();
+      moving.splice(moving.end(), wheel[level][(now >> shift) & (SLOTS - 1)]);
+      for (auto& [pid, at] : moving)
+        place(pid, at);
+    }
+  }
+};
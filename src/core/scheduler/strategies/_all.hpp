@@ -2,10 +2,26 @@
 #include "core/scheduler/SchedulerStrategy.hpp"
 #include "fcfs.hpp"
 #include "rr.hpp"
+#include "mlfq.hpp"
+#include "sjf.hpp"
+#include "srtf.hpp"
+#include "lottery.hpp"
+#include "stride.hpp"
+#include "cfs.hpp"
+#include "edf.hpp"
+#include "ws.hpp"
 
 
 auto get_scheduler_strategy(const str& name) -> SchedulerStrategy {
   if (name == "fcfs") return make_fcfs_strategy();
   if (name == "rr")   return make_rr_strategy();
+  if (name == "mlfq") return make_mlfq_strategy();
+  if (name == "sjf")  return make_sjf_strategy();
+  if (name == "srtf") return make_srtf_strategy();
+  if (name == "lottery") return make_lottery_strategy();
+  if (name == "stride")  return make_stride_strategy();
+  if (name == "cfs")     return make_cfs_strategy();
+  if (name == "edf")     return make_edf_strategy();
+  if (name == "ws")      return make_ws_strategy();
   throw runtime_error(format("Unknown strategy name: {}", name));
 }
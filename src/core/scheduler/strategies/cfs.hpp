@@ -0,0 +1,150 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+#include "core/execution/Core.hpp"
+#include "core/scheduler/SchedulerData.hpp"
+#include "core/scheduler/SchedulerStrategy.hpp"
+
+
+/**
+ * Completely Fair Strategy (preemptive, Linux CFS-style).
+ *
+ * Characteristics:
+ * - Each process accumulates virtual runtime: cycles run scaled by
+ *   NICE_0_WEIGHT / weight, where weight comes from its nice value (each nice
+ *   step is ~1.25x CPU), so higher-priority processes age more slowly.
+ *   vruntime is fixed point (NICE_0_WEIGHT units per cycle), so even nice -20
+ *   advances on a one-cycle run instead of truncating to zero.
+ * - Ready processes are ordered by vruntime in a balanced tree (std::set);
+ *   the leftmost one that has memory to run is dispatched.
+ * - A job's slice is its weight's share of `cfs-target-latency`, but never
+ *   shorter than `cfs-min-granularity`; `quantum-cycles` is not used.
+ * - A running job is also preempted once a waiting job's vruntime is lower
+ *   than its own by more than the granularity. Jobs that can't get memory
+ *   yet don't count, so neither rule fires for them.
+ * - New processes start at the queue's min_vruntime; woken sleepers get at
+ *   most half a target latency of credit, so sleeping can't bank CPU time.
+ * - `data.rqueue` is the arrival inbox, moved into the tree every tick.
+ */
+auto make_cfs_strategy() -> SchedulerStrategy {
+  static constexpr uint64 NICE_0_WEIGHT = 1024;
+
+  /** Load weight of each nice value, -20 to 19 (the kernel's sched_prio_to_weight). */
+  static constexpr array<uint,40> NICE_WEIGHTS = {
+    88761, 71755, 56483, 46273, 36291, 29154, 23254, 18705, 14949, 11916,
+     9548,  7620,  6100,  4904,  3906,  3121,  2501,  1991,  1586,  1277,
+     1024,   820,   655,   526,   423,   335,   272,   215,   172,   137,
+      110,    87,    70,    56,    45,    36,    29,    23,    18,    15,
+  };
+  static_assert(NICE_0_WEIGHT * NICE_0_WEIGHT / NICE_WEIGHTS[0] > 0, "nice -20 vruntime must advance every cycle");
+
+  /** Run tree and vruntime bookkeeping shared by the handlers. */
+  struct State {
+    std::set<tup<uint64,uint64,uint>> tree;  // (vruntime, arrival order, pid), leftmost runs next
+    umap<uint,uint64> vruntime;  // Virtual runtime of every live process (NICE_0_WEIGHT units per cycle)
+    uint64 min_vruntime = 0;     // Monotonic floor for placing arrivals
+    uint64 arrivals = 0;         // Tie-breaker keeping equal vruntimes in arrival order
+    uint64 ready_weight = 0;     // Sum of the load weights in the tree
+    uint target_latency = 0;     // Cycles in which every runnable job should run once
+    uint min_granularity = 0;    // Shortest slice / preemption threshold, in cycles
+  };
+  auto state = std::make_shared<State>();
+
+  auto weight_of = [](Process& process) -> uint64 {
+    return NICE_WEIGHTS[std::clamp(process.data.nice, -20, 19) + 20];
+  };
+
+  /** Returns the vruntime `process` gains by running `cycles` cycles. */
+  auto vruntime_for = [weight_of](Process& process, uint64 cycles) -> uint64 {
+    return cycles * NICE_0_WEIGHT * NICE_0_WEIGHT / weight_of(process);
+  };
+
+  /** Returns the vruntime of the job on `core`, including its current run. */
+  auto current_vruntime = [state, vruntime_for](Core& core) -> uint64 {
+    auto& process = core.get_job();
+    return state->vruntime[process.data.id] + vruntime_for(process, core.job_ticks);
+  };
+
+  return SchedulerStrategy()
+    .set_name("cfs")
+
+    .on_tick([state, weight_of](SchedulerData& data) {
+      auto& tree = state->tree;
+      auto sleeper_credit = cast<uint64>(state->target_latency) * NICE_0_WEIGHT / 2;
+
+      // Place arrivals: new ones at min_vruntime, woken ones with bounded credit
+      for (; !data.rqueue.empty(); data.rqueue.pop()) {
+        auto pid = data.rqueue.front();
+        auto [it, added] = state->vruntime.try_emplace(pid, state->min_vruntime);
+        auto floor = state->min_vruntime > sleeper_credit ? state->min_vruntime - sleeper_credit : uint64(0);
+        if (!added)
+          it->second = max(it->second, floor);
+        tree.emplace(it->second, state->arrivals++, pid);
+        state->ready_weight += weight_of(data.get_process(pid));
+      }
+
+      for (auto& ref : data.cores.get_idle()) {
+        auto it = std::ranges::find_if(tree, [&](auto& entry) { return data.memory_available_for(get<2>(entry)); });
+        if (it == tree.end())
+          break;
+
+        auto [vruntime, _, pid] = *it;
+        tree.erase(it);
+        state->ready_weight -= weight_of(data.get_process(pid));
+        state->min_vruntime = max(state->min_vruntime, vruntime);
+        data.dispatch(ref.get(), pid);
+      }
+    })
+
+    .on_release([state, vruntime_for](SchedulerData& data, Core& core) {
+      auto& process = core.get_job();
+      auto pid = process.data.id;
+      if (process.data.program.finished())
+        state->vruntime.erase(pid);
+      else
+        state->vruntime[pid] += vruntime_for(process, core.job_ticks);
+    })
+
+    .on_ready([state](SchedulerData& data) {
+      auto pids = vec<uint>();
+      for (auto& [_, __, pid] : state->tree)
+        pids.push_back(pid);
+      for (auto inbox = data.rqueue; !inbox.empty(); inbox.pop())
+        pids.push_back(inbox.front());
+      return pids;
+    })
+
+    .on_report([state](SchedulerData& data) {
+      auto& tree = state->tree;
+      auto cycles = [](uint64 vruntime) { return cast<double>(vruntime) / NICE_0_WEIGHT; };
+      auto report = format("CFS: {} runnable, min_vruntime {:.1f}", tree.size(), cycles(state->min_vruntime));
+      if (!tree.empty())
+        report += format(", vruntime spread {:.1f}", cycles(get<0>(*tree.rbegin()) - get<0>(*tree.begin())));
+      return report + '\n';
+    })
+
+    .on_preempt([state, weight_of, current_vruntime](SchedulerData& data) -> Core::func {
+      state->target_latency  = max(1u, data.config.getu("cfs-target-latency"));
+      state->min_granularity = max(1u, data.config.getu("cfs-min-granularity"));
+
+      return [&data, state, weight_of, current_vruntime](Core& core) -> bool {
+        if (core.job_ticks < state->min_granularity)
+          return false;
+
+        // Only the leftmost job that can get memory counts; on_tick would skip a blocked one
+        auto& tree = state->tree;
+        auto next = std::ranges::find_if(tree, [&](auto& entry) { return data.memory_available_for(get<2>(entry)); });
+        if (next == tree.end())
+          return false;
+
+        // Ideal slice: this job's weight share of the target latency
+        auto weight = weight_of(core.get_job());
+        auto slice = max<uint64>(state->min_granularity, state->target_latency * weight / (weight + state->ready_weight));
+        if (core.job_ticks >= slice)
+          return true;
+
+        // That job has fallen behind by more than the granularity
+        auto granularity = state->min_granularity * NICE_0_WEIGHT;
+        return get<0>(*next) + granularity < current_vruntime(core);
+      };
+    });
+}
@@ -0,0 +1,195 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+#include "core/execution/Core.hpp"
+#include "core/scheduler/SchedulerData.hpp"
+#include "core/scheduler/SchedulerStrategy.hpp"
+
+
+/**
+ * Earliest-Deadline-First Strategy (preemptive, soft real-time).
+ *
+ * Characteristics:
+ * - Processes with a deadline or period (screen --deadline/--period) are
+ *   real-time: they wait in a min-heap keyed by absolute deadline and always
+ *   run before the others, which are served round-robin (`quantum-cycles`).
+ * - A job is released when the process arrives; it ends when the process
+ *   sleeps or finishes. A periodic process's next job is released one period
+ *   after the last one (or when it wakes, if that is later).
+ * - A running job yields when a ready job that has memory to run has an
+ *   earlier deadline; only the core holding the latest deadline yields, one
+ *   at a time.
+ * - Jobs still pending after their deadline count as a miss once, then keep
+ *   running (soft deadlines). Misses are recorded in each process's `rt`.
+ * - Time is `data.ticks`; `data.rqueue` is the arrival inbox.
+ */
+auto make_edf_strategy() -> SchedulerStrategy {
+  static constexpr uint64 NO_DEADLINE = std::numeric_limits<uint64>::max();
+
+  /** The current job of a real-time process. */
+  struct Job {
+    uint64 release = 0;         // Tick the job was released
+    uint64 deadline = 0;        // Absolute deadline
+    bool done = true;           // Finished its work (the next arrival releases a new job)
+    bool missed = false;        // Already counted as a miss
+  };
+
+  /** Ready structures and the EDF clock shared by the handlers. */
+  struct State {
+    vec<tup<uint64,uint64,uint>> heap;  // (deadline, arrival order, pid), min-heap
+    deque<uint> background;     // Ready processes without deadlines, round-robin
+    umap<uint,Job> jobs;        // Current job of every live real-time process
+    uint64 arrivals = 0;        // Tie-breaker keeping equal deadlines in arrival order
+  };
+  auto state = std::make_shared<State>();
+  auto later = std::greater<>();  // Heap comparator: earliest deadline on top
+
+  /** Returns the absolute deadline the job on `core` runs under. */
+  auto deadline_on = [state](Core& core) -> uint64 {
+    auto it = state->jobs.find(core.get_job().data.id);
+    return it != state->jobs.end() ? it->second.deadline : NO_DEADLINE;
+  };
+
+  /** Counts a missed job once. */
+  auto miss = [](Process& process, Job& job) {
+    job.missed = true;
+    ++process.data.rt.misses;
+    ++process.data.rt.jobs;
+  };
+
+  return SchedulerStrategy()
+    .set_name("edf")
+
+    .on_tick([state, later, miss](SchedulerData& data) {
+      auto& heap = state->heap;
+      auto now = cast<uint64>(data.ticks);
+
+      // Release jobs for real-time arrivals; the rest wait in the background queue
+      for (; !data.rqueue.empty(); data.rqueue.pop()) {
+        auto pid = data.rqueue.front();
+        auto& rt = data.get_process(pid).data.rt;
+        if (!rt.enabled()) {
+          state->background.push_back(pid);
+          continue;
+        }
+
+        auto [it, added] = state->jobs.try_emplace(pid);
+        auto& job = it->second;
+        if (job.done) {
+          job.release = added || rt.period == 0 ? now : max(now, job.release + rt.period);
+          job.deadline = job.release + rt.window();
+          job.done = job.missed = false;
+        }
+        heap.emplace_back(job.deadline, state->arrivals++, pid);
+        std::ranges::push_heap(heap, later);
+      }
+
+      // Jobs still pending past their deadline
+      for (auto& [pid, job] : state->jobs)
+        if (!job.done && !job.missed && now > job.deadline)
+          miss(data.get_process(pid), job);
+
+      // Earliest deadline first, then background; set aside heads that can't get memory yet
+      auto skipped = vec<tup<uint64,uint64,uint>>();
+      for (auto& ref : data.cores.get_idle()) {
+        while (!heap.empty() && !data.memory_available_for(get<2>(heap.front()))) {
+          std::ranges::pop_heap(heap, later);
+          skipped.push_back(heap.back());
+          heap.pop_back();
+        }
+
+        if (!heap.empty()) {
+          std::ranges::pop_heap(heap, later);
+          auto pid = get<2>(heap.back());
+          heap.pop_back();
+          data.dispatch(ref.get(), pid);
+          continue;
+        }
+
+        auto& background = state->background;
+        auto it = std::ranges::find_if(background, [&](uint pid) { return data.memory_available_for(pid); });
+        if (it == background.end())
+          break;
+
+        auto pid = *it;
+        background.erase(it);
+        data.dispatch(ref.get(), pid);
+      }
+      for (auto& entry : skipped) {
+        heap.push_back(entry);
+        std::ranges::push_heap(heap, later);
+      }
+    })
+
+    .on_release([state](SchedulerData& data, Core& core) {
+      auto& process = core.get_job();
+      auto it = state->jobs.find(process.data.id);
+      if (it == state->jobs.end())
+        return;
+
+      // Sleeping or finishing ends the job; a miss was already counted when it went overdue
+      auto finished = process.data.program.finished();
+      auto& job = it->second;
+      if (finished || process.data.control.sleeping()) {
+        if (!job.missed)
+          ++process.data.rt.jobs;
+        job.done = true;
+      }
+      if (finished)
+        state->jobs.erase(it);
+    })
+
+    .on_ready([state](SchedulerData& data) {
+      auto sorted = state->heap;
+      std::ranges::sort(sorted);
+      auto pids = vec<uint>();
+      for (auto& [_, __, pid] : sorted)
+        pids.push_back(pid);
+      pids.insert(pids.end(), state->background.begin(), state->background.end());
+      for (auto inbox = data.rqueue; !inbox.empty(); inbox.pop())
+        pids.push_back(inbox.front());
+      return pids;
+    })
+
+    .on_report([state](SchedulerData& data) {
+      auto jobs = 0u, misses = 0u;
+      for (auto& [_, process] : data.proc_table) {
+        jobs += process->data.rt.jobs;
+        misses += process->data.rt.misses;
+      }
+      auto report = format("EDF: {} real-time ready, {} background ready, utilization {:.2f} / {} cores\n",
+        state->heap.size(), state->background.size(), data.realtime_utilization(), data.cores.size());
+      if (!state->heap.empty()) {
+        auto [deadline, _, pid] = state->heap.front();
+        report += format("  next deadline: {} at tick {} (now {})\n", data.get_process(pid).data.name, deadline, data.ticks);
+      }
+      return report + format("  deadline misses: {} of {} jobs\n", misses, jobs);
+    })
+
+    .on_preempt([state, deadline_on](SchedulerData& data) -> Core::func {
+      auto quantum = data.config.getu("quantum-cycles");
+      return [&data, state, deadline_on, quantum](Core& core) -> bool {
+        auto mine = deadline_on(core);
+
+        // Background jobs share the CPU round-robin
+        if (mine == NO_DEADLINE && core.job_ticks >= quantum && !state->background.empty())
+          return true;
+
+        // Only an earlier job that can get memory counts; on_tick would skip a blocked one
+        auto earlier = std::ranges::any_of(state->heap, [&](auto& entry) {
+          return get<0>(entry) < mine && data.memory_available_for(get<2>(entry));
+        });
+        if (!earlier)
+          return false;
+
+        // Earlier deadline waiting: yield if no core is already yielding and this one's deadline is the latest
+        for (auto& ref : data.cores.get_busy()) {
+          auto& other = ref.get();
+          if (&other == &core) continue;
+          if (other.can_release) return false;
+          auto theirs = deadline_on(other);
+          if (theirs > mine || (theirs == mine && other.id < core.id)) return false;
+        }
+        return true;
+      };
+    });
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+#include "core/execution/Core.hpp"
+#include "core/scheduler/SchedulerData.hpp"
+#include "core/scheduler/SchedulerStrategy.hpp"
+
+
+/**
+ * First-in-first-out family (shared by `fcfs` and `rr`).
+ *
+ * Characteristics:
+ * - Ready processes are served in arrival order; `data.rqueue` is the arrival
+ *   inbox, moved into the ready list every tick.
+ * - Backfilling (`backfill`): when the head can't get memory to run, idle
+ *   cores take the first process behind it that can, instead of waiting.
+ * - Reservation (`backfill-reserve-ticks`, off by default): once the head has
+ *   waited that many ticks, backfilling stops and freed cores stay idle until
+ *   it runs, so the head can steal frames from processes that stop running.
+ *   Only global-fifo and hinted replacement let a fault steal frames; under
+ *   fifo a head with no frames could never get one, so it is never reserved.
+ * - Counts backfilled dispatches (`dispatches.backfilled`) and how long cores
+ *   sat idle while processes were ready (`dispatches.idle_ready_ms`, in
+ *   core-milliseconds: idle cores left by each dispatch pass, times the time
+ *   until the next pass).
+ */
+auto make_fifo_strategy(const str& name) -> SchedulerStrategy {
+
+  /** Ready list and head-of-line state shared by the handlers. */
+  struct State {
+    deque<uint> ready;          // Ready pids in arrival order
+    opt<uint> blocked;          // Head that couldn't get memory on its last try
+    uint blocked_since = 0;     // Tick the head first couldn't run
+    bool backfill = true;       // Let processes behind a blocked head run
+    uint reserve_ticks = 0;     // Ticks a blocked head waits before cores are held for it (0 = never)
+    uint idle_left = 0;         // Cores the latest dispatch pass left idle with processes ready
+    opt<SteadyClock::time_point> last_pass;  // When the latest dispatch pass ran
+    uint64 idle_us = 0;         // Idle core-microseconds not yet added to the counter
+    bool configured = false;
+  };
+  auto state = std::make_shared<State>();
+
+  /** Returns true if the blocked head has waited long enough to hold cores for it, and could get a frame by stealing. */
+  auto reserved = [state](SchedulerData& data) -> bool {
+    return state->blocked && state->reserve_ticks > 0 && data.memory.allows_stealing()
+      && data.ticks - state->blocked_since >= state->reserve_ticks;
+  };
+
+  return SchedulerStrategy()
+    .set_name(name)
+
+    .on_tick([state, reserved](SchedulerData& data) {
+      if (!state->configured) {
+        state->configured = true;
+        state->backfill = data.config.getb("backfill");
+        state->reserve_ticks = data.config.getu("backfill-reserve-ticks");
+      }
+
+      // Charge the cores the previous pass left idle for the time since
+      auto& stats = data.memory.data.stats;
+      auto now = SteadyClock::now();
+      if (state->last_pass) {
+        state->idle_us += state->idle_left * cast<uint64>(duration_cast<us>(now - *state->last_pass).count());
+        stats.add("dispatches.idle_ready_ms", state->idle_us / 1000);
+        state->idle_us %= 1000;
+      }
+      state->last_pass = now;
+
+      auto& ready = state->ready;
+      for (; !data.rqueue.empty(); data.rqueue.pop())
+        ready.push_back(data.rqueue.front());
+
+      for (auto& ref : data.cores.get_idle()) {
+        // No processes to assign
+        if (ready.empty())
+          break;
+
+        // Head first, as long as at least one of its pages is loaded or a frame can be had
+        auto head = ready.front();
+        if (data.memory_available_for(head)) {
+          ready.pop_front();
+          state->blocked = nullopt;
+          data.dispatch(ref.get(), head);
+          continue;
+        }
+
+        if (state->blocked != head) {
+          state->blocked = head;
+          state->blocked_since = data.ticks;
+        }
+        if (!state->backfill || reserved(data))
+          break;
+
+        // Backfill: the first process behind the head that can run
+        auto it = std::ranges::find_if(ready.begin() + 1, ready.end(), [&](uint pid) { return data.memory_available_for(pid); });
+        if (it == ready.end())
+          break;
+
+        auto pid = *it;
+        ready.erase(it);
+        stats.add("dispatches.backfilled");
+        data.dispatch(ref.get(), pid);
+      }
+
+      state->idle_left = ready.empty() ? 0u : cast<uint>(data.cores.get_idle().size());
+    })
+
+    .on_ready([state](SchedulerData& data) {
+      auto pids = vec<uint>(state->ready.begin(), state->ready.end());
+      for (auto inbox = data.rqueue; !inbox.empty(); inbox.pop())
+        pids.push_back(inbox.front());
+      return pids;
+    })
+
+    .on_report([state, reserved](SchedulerData& data) {
+      auto& stats = data.memory.data.stats;
+      auto report = format("Ready queue: {} ready, {} backfilled, cores idle with work ready for {} core-ms\n",
+        state->ready.size(), stats.get("dispatches.backfilled"), stats.get("dispatches.idle_ready_ms"));
+      if (state->blocked && !state->ready.empty() && state->ready.front() == *state->blocked)
+        report += format("  head {} waiting for memory for {} ticks ({})\n", data.get_process(*state->blocked).data.name,
+          data.ticks - state->blocked_since, !state->backfill ? "blocking" : reserved(data) ? "cores held for it" : "backfilling");
+      return report;
+    });
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+#include "core/execution/Core.hpp"
+#include "core/scheduler/SchedulerData.hpp"
+#include "core/scheduler/SchedulerStrategy.hpp"
+#include "share.hpp"
+
+
+/**
+ * Lottery Strategy (preemptive, proportional share).
+ *
+ * Characteristics:
+ * - Each process holds `weight` tickets (screen --weight, else default-weight).
+ * - Every idle core draws a ticket among the ready processes that have memory
+ *   to run; the holder gets the core for one quantum (`quantum-cycles`).
+ * - Over many draws each process's CPU share converges to its ticket share.
+ * - `data.rqueue` is the arrival inbox, moved into the ready list every tick.
+ */
+auto make_lottery_strategy() -> SchedulerStrategy {
+
+  /** Ready list and share accounting shared by the handlers. */
+  struct State {
+    vec<uint> ready;            // Ready pids (order doesn't matter to the draw)
+    ShareLedger ledger;         // Achieved versus configured share
+  };
+  auto state = std::make_shared<State>();
+
+  return SchedulerStrategy()
+    .set_name("lottery")
+
+    .on_tick([state](SchedulerData& data) {
+      auto& ready = state->ready;
+      for (; !data.rqueue.empty(); data.rqueue.pop())
+        ready.push_back(data.rqueue.front());
+
+      for (auto& ref : data.cores.get_idle()) {
+        // Only processes that can run take part in the draw
+        auto tickets = 0u;
+        for (auto pid : ready)
+          if (data.memory_available_for(pid))
+            tickets += data.get_process(pid).data.weight;
+        if (tickets == 0)
+          break;
+
+        // Walk the ready list until the winning ticket is reached
+        auto winner = Rand::num(0u, tickets - 1);
+        for (auto it = ready.begin(); it != ready.end(); ++it) {
+          if (!data.memory_available_for(*it))
+            continue;
+
+          auto weight = data.get_process(*it).data.weight;
+          if (winner >= weight) {
+            winner -= weight;
+            continue;
+          }
+
+          auto pid = *it;
+          ready.erase(it);
+          data.dispatch(ref.get(), pid);
+          break;
+        }
+      }
+    })
+
+    .on_release([state](SchedulerData& data, Core& core) {
+      auto runnable = data.get_running_pids();
+      runnable.insert(runnable.end(), state->ready.begin(), state->ready.end());
+      state->ledger.charge(data, core, runnable);
+    })
+
+    .on_ready([state](SchedulerData& data) {
+      // Most tickets first: the likeliest next winners
+      auto pids = state->ready;
+      std::ranges::stable_sort(pids, std::greater<>(), [&](uint pid) { return data.get_process(pid).data.weight; });
+      for (auto inbox = data.rqueue; !inbox.empty(); inbox.pop())
+        pids.push_back(inbox.front());
+      return pids;
+    })
+
+    .on_report([state](SchedulerData& data) {
+      return format("Lottery: {} ready\n", state->ready.size()) + state->ledger.render();
+    })
+
+    .on_preempt([](SchedulerData& data) -> Core::func {
+      auto quantum = data.config.getu("quantum-cycles");
+      return [quantum](Core& core) -> bool {
+        return core.job_ticks >= quantum;
+      };
+    });
+}
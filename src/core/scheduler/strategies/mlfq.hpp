@@ -0,0 +1,148 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+#include "core/execution/Core.hpp"
+#include "core/scheduler/SchedulerData.hpp"
+#include "core/scheduler/SchedulerStrategy.hpp"
+
+
+/**
+ * Multi-Level Feedback Queue Strategy (preemptive).
+ *
+ * Characteristics:
+ * - `mlfq-levels` ready queues, level 0 first; each level has its own quantum
+ *   from `mlfq-quanta` (comma-separated, the last one repeats for extra levels).
+ * - New arrivals start at level 0. Using up a whole quantum demotes a process
+ *   one level; going to SLEEP before the quantum ends promotes it one level.
+ * - Every `mlfq-boost-ticks` scheduler ticks all processes return to level 0,
+ *   so long batch jobs can't be starved by a steady stream of short ones.
+ * - `data.rqueue` is the arrival inbox: new, woken and preempted processes land
+ *   there and are sorted into their level on the next tick.
+ */
+auto make_mlfq_strategy() -> SchedulerStrategy {
+
+  /** Queue state shared by the tick, release and preempt handlers. */
+  struct State {
+    vec<deque<uint>> levels;    // Ready pids per level, highest priority first
+    vec<uint> quanta;           // Quantum (in cycles) of each level
+    umap<uint,uint> level_of;   // Current level of every live process
+    uint boost_ticks = 0;       // Scheduler ticks between priority boosts (0 = never)
+    uint last_boost = 0;        // Scheduler tick of the last boost
+  };
+  auto state = std::make_shared<State>();
+
+  /** Reads the level layout from the config on first use. */
+  auto ensure_levels = [state](SchedulerData& data) {
+    if (!state->levels.empty())
+      return;
+
+    auto& config = data.config;
+    auto count = max(1u, config.getu("mlfq-levels"));
+
+    // A single quantum ("mlfq-quanta 4") is parsed as a uint, a list as a string
+    auto quanta = config.isu("mlfq-quanta") ? std::to_string(config.getu("mlfq-quanta")) : config.gets("mlfq-quanta");
+    for (auto& token : re::split(quanta, ",")) {
+      auto quantum = re::strip(token);
+      if (is_digits(quantum) && stoui(quantum) > 0)
+        state->quanta.push_back(stoui(quantum));
+    }
+    if (state->quanta.empty())
+      state->quanta.push_back(data.config.getu("quantum-cycles"));
+    state->quanta.resize(count, state->quanta.back());
+
+    state->levels.resize(count);
+    state->boost_ticks = data.config.getu("mlfq-boost-ticks");
+  };
+
+  return SchedulerStrategy()
+    .set_name("mlfq")
+
+    .on_tick([state, ensure_levels](SchedulerData& data) {
+      ensure_levels(data);
+      auto& levels = state->levels;
+
+      // Sort arrivals into their level (new processes start at the top)
+      for (; !data.rqueue.empty(); data.rqueue.pop()) {
+        auto pid = data.rqueue.front();
+        auto [it, _] = state->level_of.try_emplace(pid, 0u);
+        levels[it->second].push_back(pid);
+      }
+
+      // Periodic boost: everything back to the top level, in level order
+      if (state->boost_ticks > 0 && data.ticks >= state->last_boost + state->boost_ticks) {
+        state->last_boost = data.ticks;
+        for (auto level = 1u; level < levels.size(); ++level) {
+          std::ranges::move(levels[level], std::back_inserter(levels[0]));
+          levels[level].clear();
+        }
+        for (auto& [_, level] : state->level_of)
+          level = 0;
+      }
+
+      for (auto& ref : data.cores.get_idle()) {
+        // Highest-priority process that has memory to run
+        auto picked = false;
+        for (auto& queue : levels) {
+          auto it = std::ranges::find_if(queue, [&](uint pid) { return data.memory_available_for(pid); });
+          if (it == queue.end())
+            continue;
+
+          auto pid = *it;
+          queue.erase(it);
+          data.dispatch(ref.get(), pid);
+          picked = true;
+          break;
+        }
+
+        // Nothing runnable at any level
+        if (!picked)
+          break;
+      }
+    })
+
+    .on_release([state](SchedulerData& data, Core& core) {
+      auto& process = core.get_job();
+      auto pid = process.data.id;
+      auto it = state->level_of.find(pid);
+      if (it == state->level_of.end())
+        return;
+
+      auto& level = it->second;
+      if (process.data.program.finished())
+        state->level_of.erase(it);
+      else if (core.job_ticks >= state->quanta[level])
+        level = min<uint>(level + 1, state->levels.size() - 1);  // Used its whole quantum: CPU-bound
+      else if (process.data.control.sleeping())
+        level = level > 0 ? level - 1 : 0;  // Gave up the CPU early: interactive
+    })
+
+    .on_ready([state](SchedulerData& data) {
+      auto pids = vec<uint>();
+      for (auto& queue : state->levels)
+        pids.insert(pids.end(), queue.begin(), queue.end());
+      for (auto inbox = data.rqueue; !inbox.empty(); inbox.pop())
+        pids.push_back(inbox.front());
+      return pids;
+    })
+
+    .on_report([state](SchedulerData& data) {
+      if (state->levels.empty())
+        return ""s;
+
+      auto report = "MLFQ ready queues:\n"s;
+      for (auto level = 0u; level < state->levels.size(); ++level)
+        report += format("  L{} (quantum {:>3}): {} ready\n", level, state->quanta[level], state->levels[level].size());
+      if (!data.rqueue.empty())
+        report += format("  arriving          : {}\n", data.rqueue.size());
+      if (auto due = state->last_boost + state->boost_ticks; state->boost_ticks > 0)
+        report += format("  next boost in {} ticks\n", due - min(data.ticks, due));
+      return report;
+    })
+
+    .on_preempt([state](SchedulerData& data) -> Core::func {
+      return [state](Core& core) -> bool {
+        auto it = state->level_of.find(core.get_job().data.id);
+        auto level = it != state->level_of.end() ? it->second : 0u;
+        return level < state->quanta.size() && core.job_ticks >= state->quanta[level];
+      };
+    });
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+#include "core/execution/Core.hpp"
+#include "core/scheduler/SchedulerData.hpp"
+
+
+/**
+ * @brief Achieved versus configured CPU share, grouped by process weight.
+ *
+ * Every time a job leaves its core, the cycles it ran are credited to its
+ * weight group ("achieved"), and the same cycles are split across all groups
+ * in proportion to the weight each had runnable at that moment ("configured").
+ * A proportional-share scheduler keeps the two columns close.
+ */
+class ShareLedger {
+  public:
+
+  ShareLedger():
+    achieved   (ordered_map<uint,uint64>()),  // Cycles actually run, per weight
+    configured (ordered_map<uint,double>()),  // Cycles each weight was entitled to
+    total      (0ull) {}                      // Cycles accounted so far
+
+  /**
+   * @brief Charges the job on `core` for its run.
+   * @param runnable Pids competing for the CPU (ready and running, including this job).
+   */
+  void charge(SchedulerData& data, Core& core, const vec<uint>& runnable) {
+    auto cycles = core.job_ticks;
+    if (cycles == 0) return;
+
+    auto weights = ordered_map<uint,uint64>();
+    auto sum = 0ull;
+    for (auto pid : runnable) {
+      auto weight = data.get_process(pid).data.weight;
+      weights[weight] += weight;
+      sum += weight;
+    }
+    for (auto& [weight, share] : weights)
+      configured[weight] += cast<double>(cycles) * share / sum;
+
+    achieved[core.get_job().data.weight] += cycles;
+    total += cycles;
+  }
+
+  /** @brief Renders one line per weight group. */
+  auto render() -> str {
+    if (total == 0) return ""s;
+
+    auto out = "CPU share by weight (configured / achieved):\n"s;
+    for (auto& [weight, entitled] : configured)
+      out += format("  weight {:>5}: {:>5.1f}% / {:>5.1f}%\n", weight,
+        100.0 * entitled / total, 100.0 * achieved[weight] / total);
+    return out;
+  }
+
+  private:
+
+  // ------ Member variables ------
+  ordered_map<uint,uint64> achieved;
+  ordered_map<uint,double> configured;
+  uint64 total;
+};
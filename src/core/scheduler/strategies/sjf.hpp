@@ -0,0 +1,192 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+#include "core/execution/Core.hpp"
+#include "core/scheduler/SchedulerData.hpp"
+#include "core/scheduler/SchedulerStrategy.hpp"
+
+
+/**
+ * Shortest-job-first family (shared by `sjf` and `srtf`).
+ *
+ * Characteristics:
+ * - Ready processes sit in a min-heap keyed by their remaining work; the
+ *   shortest one that has memory to run is dispatched first (FIFO on ties).
+ * - Remaining work is exact (instructions left in the script) unless
+ *   `sjf-estimate` is set, in which case each process's next CPU burst is
+ *   predicted by exponential averaging of its past bursts:
+ *   tau' = alpha * burst + (1 - alpha) * tau, with alpha = `sjf-alpha` / 100.
+ *   A burst ends when the process sleeps or finishes; new processes start
+ *   from the average of all bursts seen so far.
+ * - `data.rqueue` is the arrival inbox, moved into the heap every tick.
+ * - Preemptive (srtf): a running job yields when a ready job that has memory
+ *   to run is shorter than what it has left. Only the core with the longest
+ *   remaining job yields, one at a time, so a single short arrival doesn't empty every core.
+ */
+auto make_shortest_first_strategy(const str& name, bool preemptive) -> SchedulerStrategy {
+
+  /** Predicted burst of a process under `sjf-estimate`. */
+  struct Burst {
+    double tau = 0;             // Predicted length of the current burst
+    uint ran = 0;               // Cycles already run in the current burst
+  };
+
+  /** Ready heap and burst history shared by the handlers. */
+  struct State {
+    vec<tup<uint,uint64,uint>> heap;  // (remaining, arrival order, pid), min-heap
+    uint64 arrivals = 0;        // Tie-breaker keeping equal keys in arrival order
+    bool estimate = false;      // Use predicted bursts instead of the script length
+    double alpha = 0.5;         // Weight of the latest burst in the prediction
+    double mean_burst = 0;      // Average of all finished bursts (start value for new processes)
+    double error_sum = 0;       // Sum of |predicted - actual| over finished bursts
+    uint bursts = 0;            // Number of finished bursts
+    umap<uint,Burst> history;   // Burst prediction per live process
+    bool configured = false;
+  };
+  auto state = std::make_shared<State>();
+  auto later = std::greater<>();  // Heap comparator: smallest key on top
+
+  /** Returns the work `pid` has left, exact or predicted. */
+  auto remaining = [state](SchedulerData& data, uint pid) -> uint {
+    auto& program = data.get_process(pid).data.program;
+    if (!state->estimate)
+      return program.ip < program.size() ? program.size() - program.ip : 0u;
+
+    auto [it, added] = state->history.try_emplace(pid);
+    if (added) it->second.tau = state->mean_burst;
+    auto left = it->second.tau - it->second.ran;
+    return left > 0 ? cast<uint>(std::lround(left)) : 0u;
+  };
+
+  auto strategy = SchedulerStrategy()
+    .set_name(name)
+
+    .on_tick([state, later, remaining](SchedulerData& data) {
+      if (!state->configured) {
+        state->configured = true;
+        state->estimate = data.config.getb("sjf-estimate");
+        state->alpha = min(100u, data.config.getu("sjf-alpha")) / 100.0;
+      }
+
+      // Key arrivals by the work they have left
+      auto& heap = state->heap;
+      for (; !data.rqueue.empty(); data.rqueue.pop()) {
+        auto pid = data.rqueue.front();
+        heap.emplace_back(remaining(data, pid), state->arrivals++, pid);
+        std::ranges::push_heap(heap, later);
+      }
+
+      // Shortest first; set aside heads that can't get memory yet
+      auto skipped = vec<tup<uint,uint64,uint>>();
+      for (auto& ref : data.cores.get_idle()) {
+        while (!heap.empty() && !data.memory_available_for(get<2>(heap.front()))) {
+          std::ranges::pop_heap(heap, later);
+          skipped.push_back(heap.back());
+          heap.pop_back();
+        }
+        if (heap.empty())
+          break;
+
+        std::ranges::pop_heap(heap, later);
+        auto pid = get<2>(heap.back());
+        heap.pop_back();
+        data.dispatch(ref.get(), pid);
+      }
+      for (auto& entry : skipped) {
+        heap.push_back(entry);
+        std::ranges::push_heap(heap, later);
+      }
+    })
+
+    .on_release([state](SchedulerData& data, Core& core) {
+      if (!state->estimate)
+        return;
+
+      auto& process = core.get_job();
+      auto it = state->history.find(process.data.id);
+      if (it == state->history.end())
+        return;
+
+      auto& burst = it->second;
+      burst.ran += core.job_ticks;
+      auto finished = process.data.program.finished();
+      if (!finished && !process.data.control.sleeping())
+        return;  // Preempted mid-burst: keep counting
+
+      // Burst over: fold it into the process's and the global prediction
+      auto alpha = state->alpha;
+      state->error_sum += std::abs(burst.tau - burst.ran);
+      state->mean_burst = state->bursts++ == 0 ? burst.ran : alpha * burst.ran + (1 - alpha) * state->mean_burst;
+      burst.tau = alpha * burst.ran + (1 - alpha) * burst.tau;
+      burst.ran = 0;
+      if (finished)
+        state->history.erase(it);
+    })
+
+    .on_ready([state](SchedulerData& data) {
+      auto sorted = state->heap;
+      std::ranges::sort(sorted);
+      auto pids = vec<uint>();
+      for (auto& [_, __, pid] : sorted)
+        pids.push_back(pid);
+      for (auto inbox = data.rqueue; !inbox.empty(); inbox.pop())
+        pids.push_back(inbox.front());
+      return pids;
+    })
+
+    .on_report([state, name](SchedulerData& data) {
+      auto& heap = state->heap;
+      auto report = format("Ready heap ({}): {} ready", name, heap.size());
+      if (!heap.empty()) {
+        auto [key, _, pid] = heap.front();
+        report += format(", next {} ({} {})", data.get_process(pid).data.name, key, state->estimate ? "predicted" : "left");
+      }
+      report += '\n';
+      if (state->estimate)
+        report += format("Burst estimate: alpha {:.2f}, mean burst {:.1f}, mean error {:.1f} over {} bursts\n",
+          state->alpha, state->mean_burst, state->bursts ? state->error_sum / state->bursts : 0.0, state->bursts);
+      return report;
+    });
+
+  if (preemptive)
+    strategy.on_preempt([state, remaining](SchedulerData& data) -> Core::func {
+      return [&data, state, remaining](Core& core) -> bool {
+        if (state->heap.empty())
+          return false;
+
+        // Work this job has left, counting what it ran since dispatch
+        auto left_of = [&](Core& other) {
+          auto left = remaining(data, other.get_job().data.id);
+          return state->estimate ? left - min(left, other.job_ticks) : left;
+        };
+
+        // Only a shorter job that can get memory counts; on_tick would skip a blocked one
+        auto mine = left_of(core);
+        auto shorter = std::ranges::any_of(state->heap, [&](auto& entry) {
+          return get<0>(entry) < mine && data.memory_available_for(get<2>(entry));
+        });
+        if (!shorter)
+          return false;
+
+        // Yield only if no core is already yielding and this one has the longest job left
+        for (auto& ref : data.cores.get_busy()) {
+          auto& other = ref.get();
+          if (&other == &core) continue;
+          if (other.can_release) return false;
+          auto theirs = left_of(other);
+          if (theirs > mine || (theirs == mine && other.id < core.id)) return false;
+        }
+        return true;
+      };
+    });
+
+  return strategy;
+}
+
+
+/**
+ * Shortest-Job-First Strategy (non-preemptive).
+ *
+ * Dispatches the ready process with the least work left; it runs until it
+ * finishes or sleeps.
+ */
+auto make_sjf_strategy() -> SchedulerStrategy { return make_shortest_first_strategy("sjf", false); }
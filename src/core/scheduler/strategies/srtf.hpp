@@ -0,0 +1,12 @@
+#pragma once
+#include "core/scheduler/SchedulerStrategy.hpp"
+#include "sjf.hpp"
+
+
+/**
+ * Shortest-Remaining-Time-First Strategy (preemptive).
+ *
+ * Like sjf, but a running process yields its core as soon as a ready process
+ * has less work left than it does (see make_shortest_first_strategy).
+ */
+auto make_srtf_strategy() -> SchedulerStrategy { return make_shortest_first_strategy("srtf", true); }
@@ -0,0 +1,111 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+#include "core/execution/Core.hpp"
+#include "core/scheduler/SchedulerData.hpp"
+#include "core/scheduler/SchedulerStrategy.hpp"
+#include "share.hpp"
+
+
+/**
+ * Stride Strategy (preemptive, proportional share).
+ *
+ * Characteristics:
+ * - Each process has a stride of STRIDE1 / weight (at least 1, so no weight
+ *   freezes its pass) and a pass value; ready processes sit in a min-heap
+ *   keyed by pass, and the lowest pass runs next.
+ * - After a run, the pass advances by stride * cycles run, so partial quanta
+ *   (sleeping early) are charged exactly.
+ * - Processes arriving or waking start no earlier than the current minimum
+ *   pass, so sleeping doesn't bank CPU time to burst with later.
+ * - Runs last at most `quantum-cycles`; `data.rqueue` is the arrival inbox.
+ */
+auto make_stride_strategy() -> SchedulerStrategy {
+  static constexpr uint64 STRIDE1 = 1ull << 32;  // Stride of a weight-1 process (above any uint weight)
+
+  /** Pass a process gains per cycle run. */
+  auto stride_of = [](Process& process) -> uint64 { return max<uint64>(1, STRIDE1 / max(1u, process.data.weight)); };
+
+  /** Pass heap and share accounting shared by the handlers. */
+  struct State {
+    vec<tup<uint64,uint64,uint>> heap;  // (pass, arrival order, pid), min-heap
+    umap<uint,uint64> pass;     // Pass value of every live process
+    uint64 global_pass = 0;     // Pass of the most recently dispatched process
+    uint64 arrivals = 0;        // Tie-breaker keeping equal passes in arrival order
+    ShareLedger ledger;         // Achieved versus configured share
+  };
+  auto state = std::make_shared<State>();
+  auto later = std::greater<>();  // Heap comparator: smallest pass on top
+
+  return SchedulerStrategy()
+    .set_name("stride")
+
+    .on_tick([state, later](SchedulerData& data) {
+      auto& heap = state->heap;
+      for (; !data.rqueue.empty(); data.rqueue.pop()) {
+        auto pid = data.rqueue.front();
+        auto& pass = state->pass[pid];
+        pass = max(pass, state->global_pass);
+        heap.emplace_back(pass, state->arrivals++, pid);
+        std::ranges::push_heap(heap, later);
+      }
+
+      // Lowest pass first; set aside heads that can't get memory yet
+      auto skipped = vec<tup<uint64,uint64,uint>>();
+      for (auto& ref : data.cores.get_idle()) {
+        while (!heap.empty() && !data.memory_available_for(get<2>(heap.front()))) {
+          std::ranges::pop_heap(heap, later);
+          skipped.push_back(heap.back());
+          heap.pop_back();
+        }
+        if (heap.empty())
+          break;
+
+        std::ranges::pop_heap(heap, later);
+        auto [pass, _, pid] = heap.back();
+        heap.pop_back();
+        state->global_pass = max(state->global_pass, pass);
+        data.dispatch(ref.get(), pid);
+      }
+      for (auto& entry : skipped) {
+        heap.push_back(entry);
+        std::ranges::push_heap(heap, later);
+      }
+    })
+
+    .on_release([state, stride_of](SchedulerData& data, Core& core) {
+      auto& process = core.get_job();
+      auto pid = process.data.id;
+
+      auto runnable = data.get_running_pids();
+      for (auto& [_, __, ready] : state->heap)
+        runnable.push_back(ready);
+      state->ledger.charge(data, core, runnable);
+
+      if (process.data.program.finished())
+        state->pass.erase(pid);
+      else
+        state->pass[pid] += stride_of(process) * core.job_ticks;
+    })
+
+    .on_ready([state](SchedulerData& data) {
+      auto sorted = state->heap;
+      std::ranges::sort(sorted);
+      auto pids = vec<uint>();
+      for (auto& [_, __, pid] : sorted)
+        pids.push_back(pid);
+      for (auto inbox = data.rqueue; !inbox.empty(); inbox.pop())
+        pids.push_back(inbox.front());
+      return pids;
+    })
+
+    .on_report([state](SchedulerData& data) {
+      return format("Stride: {} ready, global pass {}\n", state->heap.size(), state->global_pass) + state->ledger.render();
+    })
+
+    .on_preempt([](SchedulerData& data) -> Core::func {
+      auto quantum = data.config.getu("quantum-cycles");
+      return [quantum](Core& core) -> bool {
+        return core.job_ticks >= quantum;
+      };
+    });
+}
@@ -0,0 +1,171 @@
+#pragma once
+#include "core/common/imports/_all.hpp"
+#include "core/execution/Core.hpp"
+#include "core/scheduler/SchedulerData.hpp"
+#include "core/scheduler/SchedulerStrategy.hpp"
+
+
+/**
+ * Work-Stealing Strategy (preemptive, per-core run queues).
+ *
+ * Characteristics:
+ * - Every core owns a local `runqueue`. Arrivals go back to the core they
+ *   last ran on (warm caches, local NUMA memory); new processes go to the
+ *   shortest queue.
+ * - An idle core takes the front of its own queue. If that is empty, it
+ *   steals from the back of the busiest queue, preferring cores on its own
+ *   NUMA node.
+ * - Every `ws-balance-ticks` ticks a balancer moves processes from the
+ *   longest to the shortest queue until they differ by at most one.
+ * - Jobs run for `quantum-cycles`, like rr; `data.rqueue` is the arrival inbox.
+ * - Tracks steals, migrations (a process dispatched away from its last core)
+ *   and queue imbalance (longest minus shortest queue).
+ */
+auto make_ws_strategy() -> SchedulerStrategy {
+
+  /** Balancer schedule and statistics shared by the handlers. */
+  struct State {
+    uint balance_ticks = 0;     // Ticks between balancer runs (0 = never)
+    bool configured = false;
+    uint last_balance = 0;      // Scheduler tick of the last balancer run
+    uint64 samples = 0;         // Imbalance samples taken (one per on_tick)
+    uint64 steals = 0;          // Processes taken from another core's queue
+    uint64 migrations = 0;      // Dispatches onto a core other than the last one
+    uint64 balanced = 0;        // Processes moved by the balancer
+    uint64 imbalance_sum = 0;   // Sum of per-tick imbalance (for the average)
+    uint max_imbalance = 0;     // Worst imbalance seen
+  };
+  auto state = std::make_shared<State>();
+
+  /** Returns the longest minus the shortest local queue. */
+  auto imbalance = [](SchedulerData& data) -> uint {
+    auto [shortest, longest] = std::ranges::minmax(data.cores.get_all() | std::views::transform(
+      [](auto& ref) { return cast<uint>(ref.get().runqueue.size()); }));
+    return longest - shortest;
+  };
+
+  /** Takes the first process in `queue` (from the front or back) that has memory to run. */
+  auto take = [](SchedulerData& data, deque<uint>& queue, bool from_back) -> opt<uint> {
+    auto can_run = [&](uint pid) { return data.memory_available_for(pid); };
+    if (from_back) {
+      auto it = std::ranges::find_if(queue.rbegin(), queue.rend(), can_run);
+      if (it == queue.rend()) return nullopt;
+      auto pid = *it;
+      queue.erase(std::next(it).base());
+      return pid;
+    }
+    auto it = std::ranges::find_if(queue, can_run);
+    if (it == queue.end()) return nullopt;
+    auto pid = *it;
+    queue.erase(it);
+    return pid;
+  };
+
+  return SchedulerStrategy()
+    .set_name("ws")
+
+    .on_tick([state, imbalance, take](SchedulerData& data) {
+      auto cores = data.cores.get_all();
+      if (cores.empty())
+        return;
+      if (!state->configured) {
+        state->configured = true;
+        state->balance_ticks = data.config.getu("ws-balance-ticks");
+      }
+
+      // Arrivals: back to their last core, new ones to the shortest queue
+      for (; !data.rqueue.empty(); data.rqueue.pop()) {
+        auto pid = data.rqueue.front();
+        auto last = data.get_process(pid).data.core_id;
+        auto& core = last > 0 && last <= cores.size() ? cores[last - 1].get()
+          : std::ranges::min(cores, {}, [](auto& ref) { return ref.get().runqueue.size(); }).get();
+        core.runqueue.push_back(pid);
+      }
+
+      // Periodic balancer: longest to shortest until within one
+      if (state->balance_ticks > 0 && data.ticks >= state->last_balance + state->balance_ticks) {
+        state->last_balance = data.ticks;
+        auto by_length = [](auto& ref) { return ref.get().runqueue.size(); };
+        while (true) {
+          auto& longest  = std::ranges::max(cores, {}, by_length).get();
+          auto& shortest = std::ranges::min(cores, {}, by_length).get();
+          if (longest.runqueue.size() <= shortest.runqueue.size() + 1)
+            break;
+          shortest.runqueue.push_back(longest.runqueue.back());
+          longest.runqueue.pop_back();
+          ++state->balanced;
+        }
+      }
+
+      for (auto& ref : data.cores.get_idle()) {
+        auto& core = ref.get();
+        auto pid = take(data, core.runqueue, false);
+
+        // Nothing runnable locally: steal from the busiest queue, same NUMA node first
+        if (!pid) {
+          auto node = data.node_of_core(core.id);
+          auto victims = decltype(cores)();
+          for (auto& other : cores)
+            if (&other.get() != &core && !other.get().runqueue.empty())
+              victims.push_back(other);
+          std::ranges::stable_sort(victims, [&](auto& a, auto& b) {
+            auto a_local = data.node_of_core(a.get().id) == node;
+            auto b_local = data.node_of_core(b.get().id) == node;
+            if (a_local != b_local) return a_local;
+            return a.get().runqueue.size() > b.get().runqueue.size();
+          });
+          for (auto& victim : victims)
+            if ((pid = take(data, victim.get().runqueue, true))) {
+              ++state->steals;
+              break;
+            }
+        }
+        if (!pid)
+          continue;
+
+        auto last = data.get_process(*pid).data.core_id;
+        if (last != 0 && last != core.id)
+          ++state->migrations;
+        data.dispatch(core, *pid);
+      }
+
+      auto spread = imbalance(data);
+      state->imbalance_sum += spread;
+      ++state->samples;
+      state->max_imbalance = max(state->max_imbalance, spread);
+    })
+
+    .on_ready([](SchedulerData& data) {
+      // Interleave the local queues by position: each core's next job, then the one after...
+      auto pids = vec<uint>();
+      auto cores = data.cores.get_all();
+      for (auto depth = 0u, added = 1u; added > 0; ++depth) {
+        added = 0;
+        for (auto& ref : cores)
+          if (depth < ref.get().runqueue.size()) {
+            pids.push_back(ref.get().runqueue[depth]);
+            ++added;
+          }
+      }
+      for (auto inbox = data.rqueue; !inbox.empty(); inbox.pop())
+        pids.push_back(inbox.front());
+      return pids;
+    })
+
+    .on_report([state, imbalance](SchedulerData& data) {
+      auto lengths = ""s;
+      for (auto& ref : data.cores.get_all())
+        lengths += format(" {}", ref.get().runqueue.size());
+      return format("Run queues per core:{}\n", lengths)
+        + format("  steals {}, migrations {}, balancer moves {}\n", state->steals, state->migrations, state->balanced)
+        + format("  imbalance now {}, avg {:.2f}, max {}\n", data.cores.size() ? imbalance(data) : 0u,
+            state->samples ? cast<double>(state->imbalance_sum) / state->samples : 0.0, state->max_imbalance);
+    })
+
+    .on_preempt([](SchedulerData& data) -> Core::func {
+      auto quantum = data.config.getu("quantum-cycles");
+      return [quantum](Core& core) -> bool {
+        return core.job_ticks >= quantum;
+      };
+    });
+}
@@ -1,5 +1,6 @@
 #pragma once
 #include "core/common/imports/_all.hpp"
+#include "core/process/types.hpp"
 
 
 /**
@@ -16,7 +17,21 @@ class Config {
     set("scheduler", "fcfs"s);
     set("num-cpu", 1u);
     set("quantum-cycles", 1u);
+    set("mlfq-levels", 3u);          // Ready queues used by the mlfq scheduler
+    set("mlfq-quanta", "2,4,8"s);    // Per-level quanta for mlfq (comma-separated; the last repeats)
+    set("mlfq-boost-ticks", 50u);    // Ticks between mlfq priority boosts (0 = never)
+    set("sjf-estimate", false);      // sjf/srtf: predict bursts by exponential averaging instead of using script length
+    set("sjf-alpha", 50u);           // sjf/srtf: weight (percent) of the latest burst in the prediction
+    set("default-weight", 100u);     // lottery/stride: CPU share of a process (per process: screen --weight)
+    set("cfs-target-latency", 24u);  // cfs: cycles in which every runnable process should run once
+    set("cfs-min-granularity", 3u);  // cfs: shortest slice, and the vruntime lead that triggers preemption
+    set("edf-cycles-per-tick", 100u);    // edf: CPU cycles a core runs per scheduler tick (for the admission test)
+    set("ws-balance-ticks", 10u);    // ws: ticks between run-queue balancing passes (0 = steal only)
+    set("backfill", true);           // fcfs/rr: run processes behind a head that can't get memory yet
+    set("backfill-reserve-ticks", 0u);   // fcfs/rr: ticks a blocked head waits before cores are held for it (0 = never; needs global-fifo/hinted)
     set("batch-process-freq", 1u);
+    set("tick-period-ms", 100u);     // Milliseconds between scheduler ticks (the clock for sleeps and generation)
+    set("event-driven", true);       // Refill cores as soon as they free up instead of at the next tick
     set("min-ins", 1u);
     set("max-ins", 1u);
     set("delays-per-exec", 0u);
@@ -27,6 +42,23 @@ class Config {
     set("mem-per-frame", 64u);       // Frame/page size in bytes
     set("min-mem-per-proc", 128u);   // Lower bound for process allocation
     set("max-mem-per-proc", 256u);   // Upper bound for process allocation
+    set("heat-decay-ticks", 16u);    // Ticks between halvings of page access counters (0 = never)
+    set("max-rss-per-proc", 0u);     // Resident-set cap per process in bytes (0 = unlimited; per process: screen --rss)
+    set("huge-pages", false);        // Back every process with huge pages (per process: screen --huge)
+    set("huge-page-factor", 16u);    // Frames per huge page
+    set("numa-nodes", 1u);           // NUMA nodes splitting frames and cores into equal groups
+    set("numa-policy", "first-touch"s);  // Frame placement: first-touch or interleave
+    set("numa-remote-cost", 2u);     // Extra cycles per access to another node's memory
+    set("page-replacement", "fifo"s);    // Victim choice when memory is full: fifo, global-fifo or hinted
+    set("prefetch-on-dispatch", true);   // Load a process's last working set when it is assigned a core
+    set("swap-min-sleep", 8u);       // Sleepers with at least this many ticks left may be swapped out (0 = no swapper)
+    set("swap-low-frames", 2u);      // Swap sleepers out while fewer frames than this are free
+    set("swap-in-lead", 2u);         // Ticks before waking that a swapped process is brought back in
+    set("compaction-rate", 2u);      // Pages the compactor may migrate per tick (0 = no compaction)
+    set("slow-tier-frames", 0u);     // Frames in the slow memory tier (0 = single tier)
+    set("slow-tier-cost", 3u);       // Extra cycles per access to a slow-tier frame
+    set("tier-migrate-rate", 2u);    // Pages promoted to the fast tier per tick
+    set("tier-promote-heat", 4u);    // Access count at which a slow-tier page is promoted
   }
 
   /** @brief Sets the value of a configuration key. */
@@ -48,6 +80,9 @@ class Config {
   /** @brief Retrieves the value of a key as a boolean. */
   auto getb(const str& key) -> bool { return get<bool>(key); }
 
+  /** @brief Returns true if the key holds an unsigned integer (parse() turns an all-digit value into one). */
+  auto isu(const str& key) -> bool { return has(key) && entries.at(key).type() == typeid(uint); }
+
   // ------ Static Helpers ------
 
   /** @brief Parses a raw string into a typed value (bool, uint, or str). */
@@ -88,3 +123,15 @@ class Config {
     }
   }
 };
+
+
+/** @brief A user-requested process, created by the scheduler on its next tick. */
+struct SpawnRequest {
+  str name;    // Process name
+  uint size;   // Memory size in bytes
+  bool huge;   // Back the process with huge pages
+  uint rss;    // Resident-set cap in bytes (0 = use max-rss-per-proc)
+  uint weight; // Lottery tickets / stride share (0 = use default-weight)
+  int nice;    // CFS nice value (-20 to 19)
+  RealTime rt; // EDF deadline and period (disabled by default)
+};
@@ -104,12 +104,27 @@ class Shell {
     }
   }
 
-  /** @brief Executes one scheduler tick. Called repeatedly by system thread. */
+  /**
+   * @brief Executes one scheduler tick, then waits out the tick period.
+   * Called repeatedly by system thread.
+   *
+   * While waiting, cores that finish, sleep or get preempted wake this thread
+   * and are refilled immediately (`event-driven`); otherwise they sit idle
+   * until the next tick.
+   */
   void tick_system() {
-    with_locked([&] {
-      scheduler.tick();
-    });
+    auto lock = std::unique_lock(mtx);
+    scheduler.tick();
+
+    auto& config = scheduler.data.config;
+    auto period = ms(max(1u, config.getu("tick-period-ms")));  // Tick interval
+    if (!config.getb("event-driven")) {
+      lock.unlock();
+      return sleep_for(period);
+    }
 
-    sleep_for(100ms);   // Tick interval
+    auto due = SteadyClock::now() + period;
+    while (system_active && events.wait_until(lock, due, [&] { return !system_active || scheduler.has_events(); }))
+      scheduler.react();
   }
 };
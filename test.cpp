@@ -1,4 +1,5 @@
 #include "core/memory/MemoryManager.hpp"
+#include "core/process/ProgramCode.hpp"
 
 int main() {
   auto mm = MemoryManager();
@@ -16,6 +17,29 @@ int main() {
                    label, vio, fault);
   };
 
+  // Major faults are asynchronous: poll the store until the page is resident, then retry
+  auto read_resident = [&](uint vaddr) {
+    auto faulted = false;
+    while (true) {
+      auto [val, vio, fault] = vm.read(vaddr);
+      if (!fault) return tup<int,bool,bool>{ val, vio, faulted };
+      faulted = true;
+      sleep_for(ms(1));
+      mm.poll();
+    }
+  };
+
+  auto write_resident = [&](uint vaddr, uint value) {
+    auto faulted = false;
+    while (true) {
+      auto [vio, fault] = vm.write(vaddr, value);
+      if (!fault) return tup<bool,bool>{ vio, faulted };
+      faulted = true;
+      sleep_for(ms(1));
+      mm.poll();
+    }
+  };
+
   // === CASE 1: Page fault on first access ===
   cout << "\n[MARK] read @0\n";
   auto [v1, vio1, fault1] = vm.read(0);
@@ -32,12 +56,12 @@ int main() {
   vm.write(128, 333);      // Page 2 → causes eviction
 
   cout << "\n[MARK] read @0 again\n";
-  auto [v2, vio2, fault2] = vm.read(0);  // Reload evicted page
+  auto [v2, vio2, fault2] = read_resident(0);  // Reload evicted page
   print_read("[reload evicted page @0]", v2, vio2, fault2);
 
   // === CASE 3: Read across page boundary ===
   cout << "\n[MARK] read @63\n";
-  auto [v3, vio3, fault3] = vm.read(63);  // Crosses page 0 to 1
+  auto [v3, vio3, fault3] = read_resident(63);  // Crosses page 0 to 1
   print_read("[read @63 across pages]", v3, vio3, fault3);
 
   // === CASE 4: Undeclared virtual address ===
@@ -47,19 +71,57 @@ int main() {
 
   // === CASE 5: Write across boundary ===
   cout << "\n[MARK] write @63\n";
-  auto [vio5, fault5] = vm.write(63, 999);  // Split between page 0 and 1
+  auto [vio5, fault5] = write_resident(63, 999);  // Split between page 0 and 1
   print_write("[write @63 across pages]", vio5, fault5);
 
   // === Optional: Dump backing store summary ===
   cout << format("\nBacking store state:\n");
-  cout << format("  entries = {}\n", mm.data.store.size());
-  for (auto& [key, bytes] : mm.data.store) {
-    auto pid = key >> 32;
-    auto page_num = key & 0xFFFFFFFF;
+  auto entries = mm.data.store.entries();
+  cout << format("  entries = {}\n", entries.size());
+  for (auto& [key, bytes] : entries) {
+    auto pid = BackingStore::pid_of(key);
+    auto page_num = BackingStore::page_of(key);
     auto val = bytes[0] | (bytes[1] << 8); // reconstruct 16-bit value
     cout << format("  pid = {:<2} page = {:<2} | value = {}\n", pid, page_num, val);
   }
 
+  // === CASE 6: Encoded process code round trip ===
+  cout << "\n[MARK] ProgramCode round trip\n";
+  auto script = vec<Instruction>();
+  for (auto i = 0u; i < 300; ++i)  // 300 distinct names before the last opcode is first seen
+    script.push_back({ i % 3 ? "ADD"s : "PRINT"s, { format("var{}", i), "5", "007", "0x1F", "65536" } });
+  script.push_back({ "FOR", { "3" }, 305 });
+  script.push_back({ "SLEEP", { "12" } });
+  script.push_back({ "ENDFOR", {} });
+
+  auto code = ProgramCode(script);
+  auto same = [](const Instruction& a, const Instruction& b) {
+    return a.opcode == b.opcode && a.args == b.args && a.exit == b.exit;
+  };
+  auto check = [&](str label, bool ok) {
+    cout << format("  {:<32} | {}\n", label, ok ? "ok" : "MISMATCH");
+  };
+
+  auto decoded = true, resident = true;
+  for (auto ip = 0u; ip < script.size(); ++ip) {
+    decoded  = decoded  && same(code.decode(ip), script[ip]) && code.opcode_at(ip) == script[ip].opcode;
+    resident = resident && same(code.at(ip), script[ip]);
+  }
+  check("[decode] every instruction", decoded);
+  check("[at] every instruction", resident);
+
+  code.set_exit(302, 300);  // Exit recorded while its region is resident
+  code.evict();
+  check("[exits] survive evict()", code.at(300).exit == 305 && code.at(302).exit == 300 && code.at(301).exit == 0);
+  check("[evict] drops decoded regions", (code.evict(), code.resident_bytes() == 0));
+
+  auto many_opcodes = vec<Instruction>();
+  for (auto i = 0u; i < 257; ++i)
+    many_opcodes.push_back({ format("OP{}", i), {} });
+  auto rejected = false;
+  try { auto _ = ProgramCode(many_opcodes); } catch (runtime_error&) { rejected = true; }
+  check("[opcodes] 257 distinct rejected", rejected);
+
   cout << "\n";
   return 0;
 }